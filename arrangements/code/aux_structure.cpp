@@ -51,6 +51,7 @@ void AuxiliaryStructure::initFromTriangleSoup(TriangleSoup &ts)
 
     tri2pts.resize(ts.numTris());
     edge2pts.resize(ts.numEdges());
+    edge_pts_sorted = false;
     tri2segs.resize(ts.numTris());
     tri_has_intersections.resize(ts.numTris(), false);
 
@@ -94,6 +95,7 @@ bool AuxiliaryStructure::addVertexInTriangle(uint t_id, uint v_id)
 bool AuxiliaryStructure::addVertexInEdge(uint e_id, uint v_id)
 {
     assert(e_id < edge2pts.size());
+    assert(!edge_pts_sorted && "edge lists already sorted");
     auto& points = edge2pts[e_id];
     if(contains(points, v_id)) return false;
     if(points.empty()) points.reserve(8);
@@ -207,6 +209,49 @@ const auxvector<uint> &AuxiliaryStructure::edgePointsList(uint e_id) const
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
+void AuxiliaryStructure::sortEdgePointsLists(const TriangleSoup &ts, bool parallel)
+{
+    // the points of an edge are collinear, so the lexicographic order is also the order along the edge
+    auto sort_edge = [&](uint e_id)
+    {
+        auto& points = edge2pts[e_id];
+        if(points.size() < 2) return;
+
+        {
+            // the whole sort runs with upward rounding, the scope is suspended only for the uncertain comparisons
+            upwardRoundingScope scope;
+            std::sort(points.begin(), points.end(), [&](uint a, uint b)
+            {
+                const genericPoint &pa = *ts.vert(a), &pb = *ts.vert(b);
+                return (scope.refine(genericPoint::lessThanFilter(pa, pb), [&]() { return genericPoint::lessThan(pa, pb); }) < 0);
+            });
+        }
+
+        if(genericPoint::lessThan(*ts.edgeVert(e_id, 0), *ts.edgeVert(e_id, 1)) > 0)
+            std::reverse(points.begin(), points.end());
+    };
+
+    if(parallel)
+    {
+        tbb::parallel_for((uint)0, (uint)edge2pts.size(), [&](uint e_id) { sort_edge(e_id); });
+    }
+    else
+    {
+        for(uint e_id = 0; e_id < edge2pts.size(); e_id++) sort_edge(e_id);
+    }
+
+    edge_pts_sorted = true;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+bool AuxiliaryStructure::edgePointsListsAreSorted() const
+{
+    return edge_pts_sorted;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
 const auxvector<UIPair> &AuxiliaryStructure::triangleSegmentsList(uint t_id) const
 {
     assert(t_id < tri2segs.size());
@@ -167,6 +167,12 @@ class AuxiliaryStructure
 
         const auxvector<uint> &edgePointsList(uint e_id) const;
 
+        // sorts the points of each edge from edgeVert(e_id, 0) to edgeVert(e_id, 1).
+        // To be called once, after the intersection classification
+        void sortEdgePointsLists(const TriangleSoup &ts, bool parallel);
+
+        bool edgePointsListsAreSorted() const;
+
         const auxvector<UIPair> &triangleSegmentsList(uint t_id) const;
 
         const auxvector<uint> &segmentTrianglesList(const UIPair &seg) const;
@@ -191,6 +197,7 @@ class AuxiliaryStructure
         std::vector< auxvector<UIPair> > tri2segs;
         phmap::flat_hash_map< UIPair, auxvector<uint>  > seg2tris;
         std::vector<bool> tri_has_intersections;
+        bool edge_pts_sorted = false;
         aux_point_map<uint> v_map;
         phmap::flat_hash_set< std::vector<uint> > visited_pockets;
         phmap::flat_hash_map< std::vector<uint>, uint> pockets_map;
@@ -0,0 +1,357 @@
+/*****************************************************************************************
+ *              MIT License                                                              *
+ *                                                                                       *
+ * Copyright (c) 2020 Gianmarco Cherchi, Marco Livesu, Riccardo Scateni e Marco Attene   *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION     *
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        *
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                *
+ *                                                                                       *
+ * Authors:                                                                              *
+ *      Gianmarco Cherchi (g.cherchi@unica.it)                                           *
+ *      https://people.unica.it/gianmarcocherchi/                                        *
+ *                                                                                       *
+ *      Marco Livesu (marco.livesu@ge.imati.cnr.it)                                      *
+ *      http://pers.ge.imati.cnr.it/livesu/                                              *
+ *                                                                                       *
+ *      Riccardo Scateni (riccardo@unica.it)                                             *
+ *      https://people.unica.it/riccardoscateni/                                         *
+ *                                                                                       *
+ *      Marco Attene (marco.attene@ge.imati.cnr.it)                                      *
+ *      https://www.cnr.it/en/people/marco.attene/                                       *
+ *                                                                                       *
+ * ***************************************************************************************/
+
+#include "binary_impl.h"
+
+#include "phmap.h"
+
+#include <atomic>
+#include <cstring>
+#include <stdexcept>
+#include <tbb/tbb.h>
+
+namespace
+{
+
+const char     BINARY_IMPL_MAGIC[8] = "IMPLBIN";
+const uint32_t ENDIANNESS_MARK      = 0x01020304u;
+const uint32_t KIND_SHIFT           = 30;
+const uint32_t INDEX_MASK           = (1u << KIND_SHIFT) - 1;
+
+inline size_t align8(size_t n) { return (n + 7) & ~static_cast<size_t>(7); }
+
+template<typename F>
+void forEach(uint64_t n, bool parallel, const F &f)
+{
+    if(parallel) tbb::parallel_for(static_cast<uint64_t>(0), n, f);
+    else for(uint64_t i = 0; i < n; i++) f(i);
+}
+
+// byte offsets of the sections, from the counts in the header
+struct SectionOffsets
+{
+    size_t vert_refs, expl, lpi, tpi, tris, labels, end;
+
+    explicit SectionOffsets(const BinaryIMPLHeader &h)
+    {
+        vert_refs = align8(sizeof(BinaryIMPLHeader));
+        expl      = align8(vert_refs + h.num_verts    * sizeof(uint32_t));
+        lpi       = align8(expl      + h.num_explicit * 3 * sizeof(double));
+        tpi       = align8(lpi       + h.num_lpi      * 5 * sizeof(uint32_t));
+        tris      = align8(tpi       + h.num_tpi      * 9 * sizeof(uint32_t));
+        labels    = align8(tris      + h.num_tris     * 3 * sizeof(uint32_t));
+        end       = labels + h.num_tris * sizeof(uint64_t);
+    }
+};
+
+inline BinaryIMPLKind pointKind(const genericPoint *p)
+{
+    if(p->isExplicit3D())                 return IMPL_EXPLICIT;
+    if(p->isLPI() || p->isIndexedLPI())   return IMPL_LPI;
+    return IMPL_TPI;
+}
+
+// i-th explicit point defining an implicit point (either classic or indexed), in the order of the constructors
+const explicitPoint3D &definingPoint(const genericPoint *p, int i)
+{
+    if(p->isIndexedLPI() || p->isIndexedTPI()) return p->toIndexed().ref(i);
+
+    if(p->isLPI())
+    {
+        const implicitPoint3D_LPI &l = p->toLPI();
+        const explicitPoint3D *refs[5] = {&l.P(), &l.Q(), &l.R(), &l.S(), &l.T()};
+        return *refs[i];
+    }
+
+    const implicitPoint3D_TPI &t = p->toTPI();
+    const explicitPoint3D *refs[9] = {&t.V1(), &t.V2(), &t.V3(), &t.W1(), &t.W2(), &t.W3(), &t.U1(), &t.U2(), &t.U3()};
+    return *refs[i];
+}
+
+} // namespace
+
+//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+void writeBinaryIMPL(const std::string &filename, const std::vector<genericPoint*> &verts, const std::vector<uint> &tris,
+                     const std::vector<std::bitset<NBIT>> &labels, bool parallel)
+{
+    uint num_verts = static_cast<uint>(verts.size());
+
+    // index of each vertex in the section of its kind
+    std::vector<uint32_t> vert_refs(num_verts);
+    std::vector<const explicitPoint3D*> expl_points;
+    uint64_t num_of_kind[3] = {0, 0, 0};
+
+    for(uint v_id = 0; v_id < num_verts; v_id++)
+    {
+        BinaryIMPLKind kind = pointKind(verts[v_id]);
+        vert_refs[v_id] = (static_cast<uint32_t>(kind) << KIND_SHIFT) | static_cast<uint32_t>(num_of_kind[kind]++);
+        if(kind == IMPL_EXPLICIT) expl_points.push_back(&verts[v_id]->toExplicit3D());
+    }
+
+    if(num_of_kind[IMPL_EXPLICIT] > INDEX_MASK || num_of_kind[IMPL_LPI] > INDEX_MASK || num_of_kind[IMPL_TPI] > INDEX_MASK)
+        throw std::runtime_error("writeBinaryIMPL() : too many points for the format " + filename);
+
+    // explicit index of the points defining the implicit ones. They are found by address, the points
+    // that are not vertices (e.g. jolly points) are appended to the explicit section
+    phmap::flat_hash_map<const explicitPoint3D*, uint32_t> expl_id;
+    expl_id.reserve(expl_points.size());
+    for(uint32_t i = 0; i < expl_points.size(); i++) expl_id[expl_points[i]] = i;
+
+    std::vector<uint32_t> lpi_refs(5 * num_of_kind[IMPL_LPI]), tpi_refs(9 * num_of_kind[IMPL_TPI]);
+    std::atomic<bool> missing(false);
+
+    forEach(num_verts, parallel, [&](uint64_t v_id)
+    {
+        const genericPoint *p = verts[v_id];
+        BinaryIMPLKind kind = static_cast<BinaryIMPLKind>(vert_refs[v_id] >> KIND_SHIFT);
+        if(kind == IMPL_EXPLICIT) return;
+
+        uint32_t *refs = (kind == IMPL_LPI) ? &lpi_refs[5 * static_cast<size_t>(vert_refs[v_id] & INDEX_MASK)] :
+                                              &tpi_refs[9 * static_cast<size_t>(vert_refs[v_id] & INDEX_MASK)];
+        int n = (kind == IMPL_LPI) ? 5 : 9;
+
+        for(int i = 0; i < n; i++)
+        {
+            auto it = expl_id.find(&definingPoint(p, i));
+            refs[i] = (it != expl_id.end()) ? it->second : UINT32_MAX;
+            if(it == expl_id.end()) missing = true;
+        }
+    });
+
+    if(missing)
+    {
+        for(uint v_id = 0; v_id < num_verts; v_id++)
+        {
+            BinaryIMPLKind kind = static_cast<BinaryIMPLKind>(vert_refs[v_id] >> KIND_SHIFT);
+            if(kind == IMPL_EXPLICIT) continue;
+
+            uint32_t *refs = (kind == IMPL_LPI) ? &lpi_refs[5 * static_cast<size_t>(vert_refs[v_id] & INDEX_MASK)] :
+                                                  &tpi_refs[9 * static_cast<size_t>(vert_refs[v_id] & INDEX_MASK)];
+            int n = (kind == IMPL_LPI) ? 5 : 9;
+
+            for(int i = 0; i < n; i++)
+            {
+                if(refs[i] != UINT32_MAX) continue;
+
+                const explicitPoint3D *ep = &definingPoint(verts[v_id], i);
+                auto ins = expl_id.insert({ep, static_cast<uint32_t>(expl_points.size())});
+                if(ins.second) expl_points.push_back(ep);
+                refs[i] = ins.first->second;
+            }
+        }
+    }
+
+    BinaryIMPLHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, BINARY_IMPL_MAGIC, sizeof(header.magic));
+    header.version      = BINARY_IMPL_VERSION;
+    header.endianness   = ENDIANNESS_MARK;
+    header.nbit         = NBIT;
+    header.num_verts    = num_verts;
+    header.num_explicit = expl_points.size();
+    header.num_lpi      = num_of_kind[IMPL_LPI];
+    header.num_tpi      = num_of_kind[IMPL_TPI];
+    header.num_tris     = tris.size() / 3;
+
+    // the whole file is encoded in memory, section by section in parallel
+    SectionOffsets off(header);
+    std::vector<char> buffer(off.end, 0);
+
+    std::memcpy(buffer.data(), &header, sizeof(header));
+    std::memcpy(buffer.data() + off.vert_refs, vert_refs.data(), vert_refs.size() * sizeof(uint32_t));
+    std::memcpy(buffer.data() + off.lpi, lpi_refs.data(), lpi_refs.size() * sizeof(uint32_t));
+    std::memcpy(buffer.data() + off.tpi, tpi_refs.data(), tpi_refs.size() * sizeof(uint32_t));
+    std::memcpy(buffer.data() + off.tris, tris.data(), 3 * header.num_tris * sizeof(uint32_t));
+
+    double *expl = reinterpret_cast<double*>(buffer.data() + off.expl);
+    forEach(header.num_explicit, parallel, [&](uint64_t i)
+    {
+        expl[3 * i]     = expl_points[i]->X();
+        expl[3 * i + 1] = expl_points[i]->Y();
+        expl[3 * i + 2] = expl_points[i]->Z();
+    });
+
+    uint64_t *label_bits = reinterpret_cast<uint64_t*>(buffer.data() + off.labels);
+    forEach(header.num_tris, parallel, [&](uint64_t t_id)
+    {
+        label_bits[t_id] = labels[t_id].to_ullong();
+    });
+
+    FILE *fp = fopen(filename.c_str(), "wb");
+    if(!fp) throw std::runtime_error("writeBinaryIMPL() : couldn't open output file " + filename);
+
+    bool written = (fwrite(buffer.data(), 1, buffer.size(), fp) == buffer.size());
+    if(fclose(fp) != 0) written = false;
+
+    if(!written) throw std::runtime_error("writeBinaryIMPL() : couldn't write output file " + filename);
+}
+
+//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+bool BinaryIMPL::open(const std::string &filename)
+{
+    close();
+
+    if(!file.open(filename) || file.size() < sizeof(BinaryIMPLHeader)) return false;
+
+    const BinaryIMPLHeader *h = reinterpret_cast<const BinaryIMPLHeader*>(file.data());
+
+    if(std::memcmp(h->magic, BINARY_IMPL_MAGIC, sizeof(h->magic)) != 0 || h->version != BINARY_IMPL_VERSION ||
+       h->endianness != ENDIANNESS_MARK || h->nbit > NBIT ||
+       h->num_verts >= UINT32_MAX || h->num_explicit > INDEX_MASK || h->num_lpi > INDEX_MASK || h->num_tpi > INDEX_MASK ||
+       3 * h->num_tris >= UINT32_MAX)
+    {
+        file.close();
+        return false;
+    }
+
+    SectionOffsets off(*h);
+    if(off.end != file.size())
+    {
+        file.close();
+        return false;
+    }
+
+    header     = h;
+    vert_refs  = reinterpret_cast<const uint32_t*>(file.data() + off.vert_refs);
+    expl       = reinterpret_cast<const double*>(file.data() + off.expl);
+    lpi_refs   = reinterpret_cast<const uint32_t*>(file.data() + off.lpi);
+    tpi_refs   = reinterpret_cast<const uint32_t*>(file.data() + off.tpi);
+    tri_ids    = reinterpret_cast<const uint32_t*>(file.data() + off.tris);
+    label_bits = reinterpret_cast<const uint64_t*>(file.data() + off.labels);
+
+    // indices out of range would be dereferenced by buildPoints
+    std::atomic<bool> valid(true);
+    uint64_t num_of_kind[3] = {h->num_explicit, h->num_lpi, h->num_tpi};
+
+    forEach(h->num_verts, true, [&](uint64_t v_id)
+    {
+        uint32_t kind = vert_refs[v_id] >> KIND_SHIFT;
+        if(kind > IMPL_TPI || (vert_refs[v_id] & INDEX_MASK) >= num_of_kind[kind]) valid = false;
+    });
+    forEach(5 * h->num_lpi, true, [&](uint64_t i) { if(lpi_refs[i] >= h->num_explicit) valid = false; });
+    forEach(9 * h->num_tpi, true, [&](uint64_t i) { if(tpi_refs[i] >= h->num_explicit) valid = false; });
+    forEach(3 * h->num_tris, true, [&](uint64_t i) { if(tri_ids[i] >= h->num_verts) valid = false; });
+
+    if(!valid) close();
+    return valid;
+}
+
+//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+void BinaryIMPL::close()
+{
+    file.close();
+    header = nullptr;
+    vert_refs = lpi_refs = tpi_refs = tri_ids = nullptr;
+    expl = nullptr;
+    label_bits = nullptr;
+}
+
+//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+void BinaryIMPL::buildPoints(point_arena &arena, std::vector<genericPoint*> &verts, bool parallel) const
+{
+    uint num_verts = numVerts();
+    uint num_expl  = numExplicit();
+
+    // explicit points first: the implicit ones refer to them. No pointers to arena.init must exist yet,
+    // since it may be reallocated here
+    size_t base = arena.init.size();
+    arena.init.resize(base + num_expl);
+
+    forEach(num_expl, parallel, [&](uint64_t i)
+    {
+        arena.init[base + i] = explicitPoint3D(expl[3 * i], expl[3 * i + 1], expl[3 * i + 2]);
+    });
+
+    verts.resize(num_verts);
+
+    forEach(num_verts, parallel, [&](uint64_t v_id)
+    {
+        if(vertKind(static_cast<uint>(v_id)) == IMPL_EXPLICIT) verts[v_id] = &arena.init[base + (vert_refs[v_id] & INDEX_MASK)];
+    });
+
+    // implicit points are created in the arena one at a time, as in the pipeline
+    auto e = [&](uint32_t i) -> const explicitPoint3D& { return arena.init[base + i]; };
+
+    for(uint v_id = 0; v_id < num_verts; v_id++)
+    {
+        BinaryIMPLKind kind = vertKind(v_id);
+        size_t id = vert_refs[v_id] & INDEX_MASK;
+
+        if(kind == IMPL_LPI)
+        {
+            const uint32_t *r = lpi_refs + 5 * id;
+            verts[v_id] = newLPI(arena, e(r[0]), e(r[1]), e(r[2]), e(r[3]), e(r[4]));
+        }
+        else if(kind == IMPL_TPI)
+        {
+            const uint32_t *r = tpi_refs + 9 * id;
+            verts[v_id] = newTPI(arena, e(r[0]), e(r[1]), e(r[2]), e(r[3]), e(r[4]), e(r[5]), e(r[6]), e(r[7]), e(r[8]));
+        }
+    }
+}
+
+//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+void BinaryIMPL::readTriangles(std::vector<uint> &tris, std::vector<std::bitset<NBIT>> &labels, bool parallel) const
+{
+    uint num_tris = numTris();
+
+    tris.assign(tri_ids, tri_ids + 3 * static_cast<size_t>(num_tris));
+    labels.resize(num_tris);
+
+    forEach(num_tris, parallel, [&](uint64_t t_id)
+    {
+        labels[t_id] = std::bitset<NBIT>(label_bits[t_id]);
+    });
+}
+
+//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+bool readBinaryIMPL(const std::string &filename, point_arena &arena, std::vector<genericPoint*> &verts, std::vector<uint> &tris,
+                    std::vector<std::bitset<NBIT>> &labels, bool parallel)
+{
+    BinaryIMPL file(filename);
+    if(!file.isOpen()) return false;
+
+    file.buildPoints(arena, verts, parallel);
+    file.readTriangles(tris, labels, parallel);
+    return true;
+}
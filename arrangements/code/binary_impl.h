@@ -0,0 +1,138 @@
+/*****************************************************************************************
+ *              MIT License                                                              *
+ *                                                                                       *
+ * Copyright (c) 2020 Gianmarco Cherchi, Marco Livesu, Riccardo Scateni e Marco Attene   *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION     *
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        *
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                *
+ *                                                                                       *
+ * Authors:                                                                              *
+ *      Gianmarco Cherchi (g.cherchi@unica.it)                                           *
+ *      https://people.unica.it/gianmarcocherchi/                                        *
+ *                                                                                       *
+ *      Marco Livesu (marco.livesu@ge.imati.cnr.it)                                      *
+ *      http://pers.ge.imati.cnr.it/livesu/                                              *
+ *                                                                                       *
+ *      Riccardo Scateni (riccardo@unica.it)                                             *
+ *      https://people.unica.it/riccardoscateni/                                         *
+ *                                                                                       *
+ *      Marco Attene (marco.attene@ge.imati.cnr.it)                                      *
+ *      https://www.cnr.it/en/people/marco.attene/                                       *
+ *                                                                                       *
+ * ***************************************************************************************/
+
+#ifndef BINARY_IMPL_H
+#define BINARY_IMPL_H
+
+#include "common.h"
+#include <implicit_point.h>
+#include <tbb/tbb.h>
+
+#include "mapped_file.h"
+#include "utils.h"
+
+#include <bitset>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Binary counterpart of the text IMPL format (writeIMPL/readIMPL), for large exact arrangements.
+// Little endian, every section aligned to 8 bytes:
+//
+//   header       BinaryIMPLHeader
+//   vert_refs    uint32 per vertex: kind (explicit, LPI, TPI) in the 2 high bits, index in its section in the others
+//   explicit     3 doubles per explicit point: the explicit vertices, then the points that only define implicit ones
+//   lpi          5 explicit indices per LPI (P,Q,R,S,T)
+//   tpi          9 explicit indices per TPI (V1,V2,V3,W1,W2,W3,U1,U2,U3)
+//   tris         3 uint32 per triangle
+//   labels       uint64 per triangle
+
+struct BinaryIMPLHeader
+{
+    char     magic[8];     // "IMPLBIN"
+    uint32_t version;
+    uint32_t endianness;   // 0x01020304, as written by the machine that saved the file
+    uint32_t nbit;         // NBIT of the labels
+    uint32_t reserved;
+    uint64_t num_verts;
+    uint64_t num_explicit;
+    uint64_t num_lpi;
+    uint64_t num_tpi;
+    uint64_t num_tris;
+};
+
+static const uint32_t BINARY_IMPL_VERSION = 1;
+
+enum BinaryIMPLKind {IMPL_EXPLICIT = 0, IMPL_LPI = 1, IMPL_TPI = 2};
+
+// the records are encoded in parallel (if parallel is set) and written with a single call.
+// Throws std::runtime_error on I/O errors, or if a kind of point does not fit the 30 bit indices
+void writeBinaryIMPL(const std::string &filename, const std::vector<genericPoint*> &verts, const std::vector<uint> &tris,
+                     const std::vector<std::bitset<NBIT>> &labels, bool parallel = true);
+
+// Read-only view of a binary IMPL file, mapped in memory. Triangles, labels and explicit coordinates
+// are read in place. No genericPoint is created by the view: buildPoints creates all of them in one go
+class BinaryIMPL
+{
+    public:
+
+        BinaryIMPL() {}
+        explicit BinaryIMPL(const std::string &filename) { open(filename); }
+
+        // returns false if the file cannot be mapped, or it is not a (compatible) binary IMPL file
+        bool open(const std::string &filename);
+        void close();
+
+        bool isOpen() const { return header != nullptr; }
+
+        uint numVerts()    const { return static_cast<uint>(header->num_verts); }
+        uint numTris()     const { return static_cast<uint>(header->num_tris); }
+        uint numExplicit() const { return static_cast<uint>(header->num_explicit); }
+        uint numLPI()      const { return static_cast<uint>(header->num_lpi); }
+        uint numTPI()      const { return static_cast<uint>(header->num_tpi); }
+
+        BinaryIMPLKind vertKind(uint v_id) const { return static_cast<BinaryIMPLKind>(vert_refs[v_id] >> 30); }
+
+        const double   *explicitCoords() const { return expl; }
+        const uint32_t *tris()           const { return tri_ids; }
+        const uint64_t *labels()         const { return label_bits; }
+
+        // appends the points to arena (explicit ones to arena.init, implicit ones as newLPI/newTPI do)
+        // and fills verts, in the order of the file. All the points are built at once: the explicit ones
+        // in parallel, the implicit ones serially, since the arena is filled one point at a time
+        void buildPoints(point_arena &arena, std::vector<genericPoint*> &verts, bool parallel = true) const;
+
+        // copies triangles and labels in the format of readIMPL
+        void readTriangles(std::vector<uint> &tris, std::vector<std::bitset<NBIT>> &labels, bool parallel = true) const;
+
+    private:
+
+        MappedFile             file;
+        const BinaryIMPLHeader *header     = nullptr;
+        const uint32_t         *vert_refs  = nullptr;
+        const double           *expl       = nullptr;
+        const uint32_t         *lpi_refs   = nullptr;
+        const uint32_t         *tpi_refs   = nullptr;
+        const uint32_t         *tri_ids    = nullptr;
+        const uint64_t         *label_bits = nullptr;
+};
+
+// same as readIMPL, for binary files. Returns false if the file is missing or invalid
+bool readBinaryIMPL(const std::string &filename, point_arena &arena, std::vector<genericPoint*> &verts, std::vector<uint> &tris,
+                    std::vector<std::bitset<NBIT>> &labels, bool parallel = true);
+
+#endif // BINARY_IMPL_H
@@ -0,0 +1,108 @@
+/*****************************************************************************************
+ *              MIT License                                                              *
+ *                                                                                       *
+ * Copyright (c) 2020 Gianmarco Cherchi, Marco Livesu, Riccardo Scateni e Marco Attene   *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION     *
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        *
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                *
+ *                                                                                       *
+ * Authors:                                                                              *
+ *      Gianmarco Cherchi (g.cherchi@unica.it)                                           *
+ *      https://people.unica.it/gianmarcocherchi/                                        *
+ *                                                                                       *
+ *      Marco Livesu (marco.livesu@ge.imati.cnr.it)                                      *
+ *      http://pers.ge.imati.cnr.it/livesu/                                              *
+ *                                                                                       *
+ *      Riccardo Scateni (riccardo@unica.it)                                             *
+ *      https://people.unica.it/riccardoscateni/                                         *
+ *                                                                                       *
+ *      Marco Attene (marco.attene@ge.imati.cnr.it)                                      *
+ *      https://www.cnr.it/en/people/marco.attene/                                       *
+ *                                                                                       *
+ * ***************************************************************************************/
+
+#ifndef CANCELLATION_H
+#define CANCELLATION_H
+
+#include <atomic>
+#include <chrono>
+#include <limits>
+
+enum PipelineStatus {PIPELINE_COMPLETED, PIPELINE_CANCELLED, PIPELINE_DEADLINE_EXCEEDED};
+
+// Cooperative cancellation of a run of the pipeline, either explicit (cancel(), typically called by
+// another thread) or by deadline. The pipeline polls the token at phase boundaries and inside the
+// parallel loops of detection, triangulation and inside/out labeling; once a stop is requested it
+// skips the remaining work, releases its memory and reports the status. A token can be reused
+// for another run after reset().
+class CancellationToken
+{
+    public:
+
+        void cancel() { cancelled.store(true, std::memory_order_relaxed); }
+
+        void setDeadline(std::chrono::steady_clock::time_point d) { deadline.store(d.time_since_epoch().count(), std::memory_order_relaxed); }
+
+        void setTimeBudget(double seconds)
+        {
+            auto budget = std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(seconds));
+            setDeadline(std::chrono::steady_clock::now() + budget);
+        }
+
+        void reset()
+        {
+            cancelled.store(false, std::memory_order_relaxed);
+            expired.store(false, std::memory_order_relaxed);
+            deadline.store(NO_DEADLINE, std::memory_order_relaxed);
+        }
+
+        // true if the run should stop as soon as possible
+        bool stopRequested() const
+        {
+            if(cancelled.load(std::memory_order_relaxed) || expired.load(std::memory_order_relaxed)) return true;
+
+            std::chrono::steady_clock::rep d = deadline.load(std::memory_order_relaxed);
+            if(d == NO_DEADLINE || std::chrono::steady_clock::now().time_since_epoch().count() < d) return false;
+
+            expired.store(true, std::memory_order_relaxed);
+            return true;
+        }
+
+        // reason of the stop, PIPELINE_COMPLETED if no stop was requested
+        PipelineStatus status() const
+        {
+            if(cancelled.load(std::memory_order_relaxed)) return PIPELINE_CANCELLED;
+            if(stopRequested())                           return PIPELINE_DEADLINE_EXCEEDED;
+            return PIPELINE_COMPLETED;
+        }
+
+    private:
+
+        static constexpr std::chrono::steady_clock::rep NO_DEADLINE = std::numeric_limits<std::chrono::steady_clock::rep>::max();
+
+        std::atomic<bool>                           cancelled = false;
+        mutable std::atomic<bool>                   expired   = false; // deadline passed, cached to spare the clock reads
+        std::atomic<std::chrono::steady_clock::rep> deadline  = NO_DEADLINE;
+};
+
+// a null token never requests a stop
+inline bool stopRequested(const CancellationToken *token)
+{
+    return token && token->stopRequested();
+}
+
+#endif // CANCELLATION_H
@@ -43,6 +43,16 @@
 
 enum Plane {XY, YZ, ZX};
 
+// engine used to split each intersected triangle:
+// SPLIT_AND_WALK       - point insertion by triangle split, constraints by walking crossings and earcut
+// CONSTRAINED_DELAUNAY - incremental Delaunay point insertion, constraints restored with Lawson flips
+enum TriangulationEngine {SPLIT_AND_WALK, CONSTRAINED_DELAUNAY};
+
+// order in which the intersected triangles are handed to the workers:
+// INPUT_ORDER - in input order, with the default partitioner (default)
+// COST_ORDER  - by decreasing estimated cost, one task per triangle (see sortTrianglesByEstimatedCost)
+enum TriangulationSchedule {INPUT_ORDER, COST_ORDER};
+
 inline Plane intToPlane(const int &norm)
 {
     if(norm == 0) return YZ;
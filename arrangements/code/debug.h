@@ -132,6 +132,12 @@ cinolib::vec3d genericPointToCinolib(const genericPoint &p)
         ip.getApproxXYZCoordinates(x, y, z);
         return cinolib::vec3d(x, y, z);
     }
+    else if(p.isIndexed())
+    {
+        double x, y, z;
+        p.getApproxXYZCoordinates(x, y, z);
+        return cinolib::vec3d(x, y, z);
+    }
     return cinolib::vec3d(0,0,0); // warning killer
 }
 
@@ -157,6 +163,12 @@ explicitPoint3D genericPointToExplicit(const genericPoint &p)
         ip.getApproxXYZCoordinates(x, y, z);
         return explicitPoint3D(x, y, z);
     }
+    else if(p.isIndexed())
+    {
+        double x, y, z;
+        p.getApproxXYZCoordinates(x, y, z);
+        return explicitPoint3D(x, y, z);
+    }
 
     return explicitPoint3D(0,0,0); // warning killer
 }
@@ -187,6 +199,13 @@ std::string genericPointToString(const genericPoint &p)
 
         return "(" + std::to_string(x) + ", " + std::to_string(y) + ", " + std::to_string(z) + ");\n";
     }
+    else if(p.isIndexed())
+    {
+        double x, y, z;
+        p.getApproxXYZCoordinates(x, y, z);
+
+        return "(" + std::to_string(x) + ", " + std::to_string(y) + ", " + std::to_string(z) + ");\n";
+    }
 
     assert(false);
     return "(0.0, 0.0, 0.0)"; //warning killer
@@ -198,6 +217,7 @@ void printGenericPoint(const genericPoint &p)
     if(p.isExplicit3D())    std::cerr << "EXP: " + genericPointToString(p) << std::endl;
     else if(p.isLPI())      std::cerr << "LPI: " + genericPointToString(p) << std::endl;
     else if(p.isTPI())      std::cerr << "TPI: " + genericPointToString(p) << std::endl;
+    else if(p.isIndexed())  std::cerr << "IDX: " + genericPointToString(p) << std::endl;
 }
 
 
@@ -229,6 +249,14 @@ void printGenericPointExploded(const genericPoint &gp)
         std::cerr << "explicitPoint3D W3i" + genericPointToString(gp.toTPI().W3());
         std::cerr << "implicitPoint3D_TPI L(U1i, U2i, U3i, V1i, V2i, V3i, W1i, W2i, W3i); " << std::endl;
     }
+
+    else if(gp.isIndexed())
+    {
+        const implicitPoint3D_IDX &ip = gp.toIndexed();
+        for(int i = 0; i < ip.numRefs(); i++)
+            std::cerr << "explicitPoint3D R" + std::to_string(i) + "i" + genericPointToString(ip.ref(i));
+        std::cerr << ((gp.isIndexedLPI()) ? "implicitPoint3D_LPI L(R0i, R1i, R2i, R3i, R4i); " : "implicitPoint3D_TPI L(R0i, R1i, R2i, R3i, R4i, R5i, R6i, R7i, R8i); ") << std::endl;
+    }
 }
 
 
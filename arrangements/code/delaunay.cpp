@@ -0,0 +1,204 @@
+/*****************************************************************************************
+ *              MIT License                                                              *
+ *                                                                                       *
+ * Copyright (c) 2022 G. Cherchi, M. Livesu, R. Scateni, M. Attene and F. Pellacini      *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION     *
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        *
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                *
+ *                                                                                       *
+ * Authors:                                                                              *
+ *      Gianmarco Cherchi (g.cherchi@unica.it)                                           *
+ *      https://www.gianmarcocherchi.com                                                 *
+ *                                                                                       *
+ *      Marco Livesu (marco.livesu@ge.imati.cnr.it)                                      *
+ *      http://pers.ge.imati.cnr.it/livesu/                                              *
+ *                                                                                       *
+ *      Riccardo Scateni (riccardo@unica.it)                                             *
+ *      https://people.unica.it/riccardoscateni/                                         *
+ *                                                                                       *
+ *      Marco Attene (marco.attene@ge.imati.cnr.it)                                      *
+ *      https://www.cnr.it/en/people/marco.attene/                                       *
+ *                                                                                       *
+ *      Fabio Pellacini (fabio.pellacini@uniroma1.it)                                    *
+ *      https://pellacini.di.uniroma1.it                                                 *
+ *                                                                                       *
+ * ***************************************************************************************/
+
+
+#include "delaunay.h"
+
+int inCircumcircle(const genericPoint &a, const genericPoint &b, const genericPoint &c, const genericPoint &d,
+                   const genericPoint &jolly)
+{
+    // the sphere through a, b, c and the jolly point cuts the plane of the triangle along the circumcircle of a, b, c
+    return genericPoint::inSphere(a, b, c, jolly, d) * genericPoint::orient3D(a, b, c, jolly);
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+const genericPoint *nonCoplanarJollyPoint(const TriangleSoup &ts, uint t_id)
+{
+    for(uint jp_id = 0; jp_id < 5; jp_id++)
+    {
+        if(genericPoint::orient3D(*ts.triVert(t_id, 0), *ts.triVert(t_id, 1), *ts.triVert(t_id, 2), *ts.jollyPoint(jp_id)) != 0)
+            return ts.jollyPoint(jp_id);
+    }
+
+    assert(false && "no jolly point found");
+    return ts.jollyPoint(0); // warning killer
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+void insertPointsDelaunay(const TriangleSoup &ts, FastTrimesh &subm, const auxvector<uint> &points, const genericPoint *jolly)
+{
+    if(points.empty()) return;
+
+    const int orientation = subm.triOrientation(0);
+    uint start_t_id = 0;
+
+    std::vector<UIPair> edge_stack;
+
+    for(uint p_id : points)
+    {
+        uint v_pos = subm.addVert(ts.vert(p_id), p_id);
+
+        int cont_t_id = locatePointByWalking(subm, v_pos, start_t_id, orientation);
+        if(cont_t_id < 0) cont_t_id = findContainingTriangle(subm, v_pos);
+        assert(cont_t_id >= 0 && "No containing triangle found!");
+
+        uint e0_id = static_cast<uint>(subm.triEdgeID(static_cast<uint>(cont_t_id), 0));
+        uint e1_id = static_cast<uint>(subm.triEdgeID(static_cast<uint>(cont_t_id), 1));
+        uint e2_id = static_cast<uint>(subm.triEdgeID(static_cast<uint>(cont_t_id), 2));
+
+        if(fastPointOnLine(subm, e0_id, v_pos))
+            subm.splitEdge(e0_id, v_pos);
+
+        else if(fastPointOnLine(subm, e1_id, v_pos))
+            subm.splitEdge(e1_id, v_pos);
+
+        else if(fastPointOnLine(subm, e2_id, v_pos))
+            subm.splitEdge(e2_id, v_pos);
+
+        else subm.splitTri(static_cast<uint>(cont_t_id), v_pos);
+
+        // the link of the new vertex is the only part of the mesh that can be non Delaunay
+        edge_stack.clear();
+        for(uint t_id : subm.adjV2T(v_pos))
+        {
+            uint e_id = subm.edgeOppToVert(t_id, v_pos);
+            edge_stack.push_back(subm.edge(e_id));
+        }
+
+        legalizeEdges(subm, edge_stack, jolly);
+
+        start_t_id = subm.adjV2T(v_pos).front();
+    }
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// visibility walk from start_t_id towards p_id. Returns -1 if the walk does not converge
+int locatePointByWalking(const FastTrimesh &subm, uint p_id, uint start_t_id, const int orientation)
+{
+    const genericPoint *p = subm.vert(p_id);
+    uint curr_t_id = start_t_id;
+
+    for(uint step = 0; step <= subm.numTris(); step++)
+    {
+        int next_t_id = -1;
+
+        for(uint off = 0; off < 3 && next_t_id < 0; off++)
+        {
+            uint v0_id = subm.triVertID(curr_t_id, off);
+            uint v1_id = subm.triVertID(curr_t_id, (off + 1) % 3);
+
+            if(customOrient2D(subm.vert(v0_id), subm.vert(v1_id), p, subm.refPlane()) != -orientation) continue;
+
+            // p is beyond the edge v0-v1
+            uint e_id = static_cast<uint>(subm.edgeID(v0_id, v1_id));
+            for(uint t_id : subm.adjE2T(e_id))
+                if(t_id != curr_t_id) next_t_id = static_cast<int>(t_id);
+
+            if(next_t_id < 0) return -1; // beyond the boundary: should not happen
+        }
+
+        if(next_t_id < 0) return static_cast<int>(curr_t_id);
+        curr_t_id = static_cast<uint>(next_t_id);
+    }
+
+    return -1;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+bool edgeIsLocallyDelaunay(const FastTrimesh &subm, uint e_id, const genericPoint *jolly)
+{
+    if(subm.edgeIsConstr(e_id) || subm.adjE2T(e_id).size() != 2) return true;
+
+    uint ev0_id = subm.edgeVertID(e_id, 0);
+    uint ev1_id = subm.edgeVertID(e_id, 1);
+    uint t0_id  = subm.adjE2T(e_id)[0];
+    uint t1_id  = subm.adjE2T(e_id)[1];
+
+    uint opp1_id = subm.triVertOppositeTo(t1_id, ev0_id, ev1_id);
+
+    return inCircumcircle(*subm.triVert(t0_id, 0), *subm.triVert(t0_id, 1), *subm.triVert(t0_id, 2),
+                          *subm.vert(opp1_id), *jolly) <= 0;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// Lawson flips. Edges are stored by their endpoints, since flipEdge does not preserve ids
+void legalizeEdges(FastTrimesh &subm, std::vector<UIPair> &edge_stack, const genericPoint *jolly)
+{
+    while(!edge_stack.empty())
+    {
+        UIPair e = edge_stack.back();
+        edge_stack.pop_back();
+
+        int e_id = subm.edgeID(e.first, e.second);
+        if(e_id < 0 || edgeIsLocallyDelaunay(subm, static_cast<uint>(e_id), jolly)) continue;
+
+        uint t0_id = subm.adjE2T(static_cast<uint>(e_id))[0];
+        uint t1_id = subm.adjE2T(static_cast<uint>(e_id))[1];
+        uint opp0_id = subm.triVertOppositeTo(t0_id, e.first, e.second);
+        uint opp1_id = subm.triVertOppositeTo(t1_id, e.first, e.second);
+
+        // a non locally Delaunay edge always has a convex quad, so the flip is valid
+        subm.flipEdge(static_cast<uint>(e_id));
+
+        edge_stack.emplace_back(e.first,  opp0_id);
+        edge_stack.emplace_back(opp0_id,  e.second);
+        edge_stack.emplace_back(e.second, opp1_id);
+        edge_stack.emplace_back(opp1_id,  e.first);
+    }
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// restores the (constrained) Delaunay property on the whole sub-mesh. Constrained edges are never flipped
+void delaunayFlips(FastTrimesh &subm, const genericPoint *jolly)
+{
+    std::vector<UIPair> edge_stack;
+    edge_stack.reserve(subm.numEdges());
+
+    for(uint e_id = 0; e_id < subm.numEdges(); e_id++)
+        edge_stack.push_back(subm.edge(e_id));
+
+    legalizeEdges(subm, edge_stack, jolly);
+}
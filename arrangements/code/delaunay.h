@@ -0,0 +1,68 @@
+/*****************************************************************************************
+ *              MIT License                                                              *
+ *                                                                                       *
+ * Copyright (c) 2022 G. Cherchi, M. Livesu, R. Scateni, M. Attene and F. Pellacini      *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION     *
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        *
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                *
+ *                                                                                       *
+ * Authors:                                                                              *
+ *      Gianmarco Cherchi (g.cherchi@unica.it)                                           *
+ *      https://www.gianmarcocherchi.com                                                 *
+ *                                                                                       *
+ *      Marco Livesu (marco.livesu@ge.imati.cnr.it)                                      *
+ *      http://pers.ge.imati.cnr.it/livesu/                                              *
+ *                                                                                       *
+ *      Riccardo Scateni (riccardo@unica.it)                                             *
+ *      https://people.unica.it/riccardoscateni/                                         *
+ *                                                                                       *
+ *      Marco Attene (marco.attene@ge.imati.cnr.it)                                      *
+ *      https://www.cnr.it/en/people/marco.attene/                                       *
+ *                                                                                       *
+ *      Fabio Pellacini (fabio.pellacini@uniroma1.it)                                    *
+ *      https://pellacini.di.uniroma1.it                                                 *
+ *                                                                                       *
+ * ***************************************************************************************/
+
+
+#ifndef DELAUNAY_H
+#define DELAUNAY_H
+
+#include "triangulation.h"
+
+typedef unsigned int uint;
+
+// > 0 if d is strictly inside the circumcircle of <a,b,c>, < 0 if outside, 0 if cocircular.
+// All points lie on the plane of the original triangle, and the circle is lifted to the sphere through
+// a, b, c and the jolly point (not coplanar with them). The test is the same for every plane, so the
+// triangulation is Delaunay in the plane of the triangle whatever its projection plane
+int inCircumcircle(const genericPoint &a, const genericPoint &b, const genericPoint &c, const genericPoint &d,
+                   const genericPoint &jolly);
+
+const genericPoint *nonCoplanarJollyPoint(const TriangleSoup &ts, uint t_id);
+
+void insertPointsDelaunay(const TriangleSoup &ts, FastTrimesh &subm, const auxvector<uint> &points, const genericPoint *jolly);
+
+int locatePointByWalking(const FastTrimesh &subm, uint p_id, uint start_t_id, const int orientation);
+
+bool edgeIsLocallyDelaunay(const FastTrimesh &subm, uint e_id, const genericPoint *jolly);
+
+void legalizeEdges(FastTrimesh &subm, std::vector<UIPair> &edge_stack, const genericPoint *jolly);
+
+void delaunayFlips(FastTrimesh &subm, const genericPoint *jolly);
+
+#endif // DELAUNAY_H
@@ -0,0 +1,835 @@
+/*****************************************************************************************
+ *              MIT License                                                              *
+ *                                                                                       *
+ * Copyright (c) 2020 Gianmarco Cherchi, Marco Livesu, Riccardo Scateni e Marco Attene   *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION     *
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        *
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                *
+ *                                                                                       *
+ * Authors:                                                                              *
+ *      Gianmarco Cherchi (g.cherchi@unica.it)                                           *
+ *      https://people.unica.it/gianmarcocherchi/                                        *
+ *                                                                                       *
+ *      Marco Livesu (marco.livesu@ge.imati.cnr.it)                                      *
+ *      http://pers.ge.imati.cnr.it/livesu/                                              *
+ *                                                                                       *
+ *      Riccardo Scateni (riccardo@unica.it)                                             *
+ *      https://people.unica.it/riccardoscateni/                                         *
+ *                                                                                       *
+ *      Marco Attene (marco.attene@ge.imati.cnr.it)                                      *
+ *      https://www.cnr.it/en/people/marco.attene/                                       *
+ *                                                                                       *
+ * ***************************************************************************************/
+
+#include "fast_readers.h"
+#include "mapped_file.h"
+
+#include "phmap.h"
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <sstream>
+#include <tbb/tbb.h>
+
+//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+namespace
+{
+
+const size_t CHUNK_SIZE = 1 << 20; // bytes parsed by a single task
+
+inline bool isBlank(char c) { return c == ' ' || c == '\t' || c == '\r'; }
+
+inline const char *skipBlanks(const char *p, const char *end)
+{
+    while(p < end && isBlank(*p)) p++;
+    return p;
+}
+
+inline const char *lineEnd(const char *p, const char *end)
+{
+    while(p < end && *p != '\n') p++;
+    return p;
+}
+
+// splits [begin,end) in about size/CHUNK_SIZE chunks, each one starting at the beginning of a line
+std::vector<const char*> splitAtLines(const char *begin, const char *end)
+{
+    std::vector<const char*> bounds = {begin};
+
+    const char *p = begin;
+    while(static_cast<size_t>(end - p) > CHUNK_SIZE)
+    {
+        p = lineEnd(p + CHUNK_SIZE, end);
+        if(p < end) p++;
+        bounds.push_back(p);
+    }
+
+    if(bounds.back() != end) bounds.push_back(end);
+    return bounds;
+}
+
+inline bool parseDouble(const char *&p, const char *end, double &v)
+{
+    p = skipBlanks(p, end);
+    if(p < end && *p == '+') p++; // not accepted by from_chars
+    std::from_chars_result r = std::from_chars(p, end, v);
+    if(r.ec != std::errc()) return false;
+    p = r.ptr;
+    return true;
+}
+
+inline bool parseInt(const char *&p, const char *end, int64_t &v)
+{
+    p = skipBlanks(p, end);
+    if(p < end && *p == '+') p++;
+    std::from_chars_result r = std::from_chars(p, end, v);
+    if(r.ec != std::errc()) return false;
+    p = r.ptr;
+    return true;
+}
+
+// number of whitespace separated tokens in [p,end)
+inline uint countTokens(const char *p, const char *end)
+{
+    uint n = 0;
+    while(true)
+    {
+        p = skipBlanks(p, end);
+        if(p >= end) return n;
+        n++;
+        while(p < end && !isBlank(*p)) p++;
+    }
+}
+
+// prefix sums of the per chunk counts, in place. Returns the total
+template<typename T>
+T exclusiveScan(std::vector<T> &counts)
+{
+    T sum = 0;
+    for(T &c : counts)
+    {
+        T tmp = c;
+        c = sum;
+        sum += tmp;
+    }
+    return sum;
+}
+
+} // namespace
+
+//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+bool fastReadOBJ(const std::string &filename, std::vector<double> &coords, std::vector<uint> &tris)
+{
+    coords.clear();
+    tris.clear();
+
+    MappedFile file(filename);
+    if(!file.isOpen()) return false;
+
+    std::vector<const char*> bounds = splitAtLines(file.begin(), file.end());
+    uint num_chunks = static_cast<uint>(bounds.size() - 1);
+
+    // first pass: count vertices and triangles of each chunk
+    std::vector<uint64_t> chunk_verts(num_chunks, 0), chunk_tris(num_chunks, 0);
+
+    tbb::parallel_for((uint)0, num_chunks, [&](uint c)
+    {
+        const char *p = bounds[c], *end = bounds[c +1];
+        while(p < end)
+        {
+            const char *le = lineEnd(p, end);
+            p = skipBlanks(p, le);
+
+            if(le - p > 1 && isBlank(p[1]))
+            {
+                if(p[0] == 'v') chunk_verts[c]++;
+                else if(p[0] == 'f')
+                {
+                    uint n = countTokens(p +1, le);
+                    if(n >= 3) chunk_tris[c] += n - 2;
+                }
+            }
+            p = le +1;
+        }
+    });
+
+    uint64_t num_verts = exclusiveScan(chunk_verts);
+    uint64_t num_tris  = exclusiveScan(chunk_tris);
+    if(num_verts >= UINT32_MAX || 3 * num_tris >= UINT32_MAX) return false;
+
+    coords.resize(3 * num_verts);
+    tris.resize(3 * num_tris);
+
+    // second pass: parse each chunk at its offsets
+    std::atomic<bool> failed(false);
+
+    tbb::parallel_for((uint)0, num_chunks, [&](uint c)
+    {
+        uint64_t v_off = chunk_verts[c], t_off = chunk_tris[c];
+        const char *p = bounds[c], *end = bounds[c +1];
+
+        while(p < end && !failed)
+        {
+            const char *le = lineEnd(p, end);
+            p = skipBlanks(p, le);
+
+            if(le - p > 1 && isBlank(p[1]) && p[0] == 'v')
+            {
+                const char *q = p +1;
+                double *v = coords.data() + 3 * v_off;
+                if(!parseDouble(q, le, v[0]) || !parseDouble(q, le, v[1]) || !parseDouble(q, le, v[2])) failed = true;
+                v_off++;
+            }
+            else if(le - p > 1 && isBlank(p[1]) && p[0] == 'f' && countTokens(p +1, le) >= 3)
+            {
+                // each token is v, v/vt, v//vn or v/vt/vn; negative indices are relative to the current vertex
+                const char *q = p +1;
+                uint first = 0, prev = 0, n = 0;
+                while(true)
+                {
+                    q = skipBlanks(q, le);
+                    if(q >= le) break;
+
+                    int64_t idx;
+                    if(!parseInt(q, le, idx) || idx == 0) { failed = true; break; }
+                    int64_t v_id = (idx > 0) ? idx - 1 : static_cast<int64_t>(v_off) + idx;
+                    if(v_id < 0 || v_id >= static_cast<int64_t>(num_verts)) { failed = true; break; }
+
+                    while(q < le && !isBlank(*q)) q++; // skip the texture and normal references
+
+                    uint curr = static_cast<uint>(v_id);
+                    if(n == 0) first = curr;
+                    else if(n >= 2)
+                    {
+                        uint *t = tris.data() + 3 * t_off++;
+                        t[0] = first;
+                        t[1] = prev;
+                        t[2] = curr;
+                    }
+                    prev = curr;
+                    n++;
+                }
+            }
+            p = le +1;
+        }
+    });
+
+    if(failed)
+    {
+        coords.clear();
+        tris.clear();
+        return false;
+    }
+
+    return true;
+}
+
+//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+bool fastReadOFF(const std::string &filename, std::vector<double> &coords, std::vector<uint> &tris)
+{
+    coords.clear();
+    tris.clear();
+
+    MappedFile file(filename);
+    if(!file.isOpen()) return false;
+
+    const char *p = file.begin(), *end = file.end();
+
+    // header: OFF, then the number of vertices, faces and edges, possibly on the same line
+    auto skipComments = [&]()
+    {
+        while(true)
+        {
+            while(p < end && (isBlank(*p) || *p == '\n')) p++;
+            if(p < end && *p == '#') p = lineEnd(p, end);
+            else return;
+        }
+    };
+
+    skipComments();
+    if(end - p < 3 || p[0] != 'O' || p[1] != 'F' || p[2] != 'F' || (end - p > 3 && !isBlank(p[3]) && p[3] != '\n')) return false;
+    p += 3;
+
+    int64_t nv, nf, ne;
+    skipComments();
+    if(!parseInt(p, end, nv)) return false;
+    skipComments();
+    if(!parseInt(p, end, nf)) return false;
+    skipComments();
+    if(!parseInt(p, end, ne)) return false;
+    if(nv < 0 || nf < 0 || nv >= UINT32_MAX) return false;
+
+    p = lineEnd(p, end);
+    if(p < end) p++;
+
+    std::vector<const char*> bounds = splitAtLines(p, end);
+    uint num_chunks = static_cast<uint>(bounds.size() - 1);
+
+    auto isDataLine = [](const char *&q, const char *le)
+    {
+        q = skipBlanks(q, le);
+        return (q < le && *q != '#');
+    };
+
+    // first pass: count the data lines of each chunk, then the triangles of the face lines
+    std::vector<uint64_t> chunk_lines(num_chunks, 0), chunk_tris(num_chunks, 0);
+
+    tbb::parallel_for((uint)0, num_chunks, [&](uint c)
+    {
+        const char *q = bounds[c], *e = bounds[c +1];
+        while(q < e)
+        {
+            const char *le = lineEnd(q, e);
+            if(isDataLine(q, le)) chunk_lines[c]++;
+            q = le +1;
+        }
+    });
+
+    uint64_t num_lines = exclusiveScan(chunk_lines);
+    if(num_lines < static_cast<uint64_t>(nv + nf)) return false; // vertices or faces spanning multiple lines
+
+    std::atomic<bool> failed(false);
+
+    tbb::parallel_for((uint)0, num_chunks, [&](uint c)
+    {
+        uint64_t line = chunk_lines[c];
+        const char *q = bounds[c], *e = bounds[c +1];
+        while(q < e && !failed)
+        {
+            const char *le = lineEnd(q, e);
+            if(isDataLine(q, le))
+            {
+                if(line >= static_cast<uint64_t>(nv) && line < static_cast<uint64_t>(nv + nf))
+                {
+                    int64_t n;
+                    if(!parseInt(q, le, n) || n < 3) failed = true;
+                    else chunk_tris[c] += n - 2;
+                }
+                line++;
+            }
+            q = le +1;
+        }
+    });
+
+    if(failed) return false;
+
+    uint64_t num_tris = exclusiveScan(chunk_tris);
+    if(3 * num_tris >= UINT32_MAX) return false;
+
+    coords.resize(3 * nv);
+    tris.resize(3 * num_tris);
+
+    // second pass: parse each chunk at its offsets
+    tbb::parallel_for((uint)0, num_chunks, [&](uint c)
+    {
+        uint64_t line = chunk_lines[c], t_off = chunk_tris[c];
+        const char *q = bounds[c], *e = bounds[c +1];
+        while(q < e && !failed)
+        {
+            const char *le = lineEnd(q, e);
+            if(isDataLine(q, le))
+            {
+                if(line < static_cast<uint64_t>(nv))
+                {
+                    double *v = coords.data() + 3 * line;
+                    if(!parseDouble(q, le, v[0]) || !parseDouble(q, le, v[1]) || !parseDouble(q, le, v[2])) failed = true;
+                }
+                else if(line < static_cast<uint64_t>(nv + nf))
+                {
+                    int64_t n, idx[3];
+                    parseInt(q, le, n);
+                    for(int64_t i = 0; i < n && !failed; i++)
+                    {
+                        int64_t &v_id = idx[(i < 2) ? i : 2];
+                        if(!parseInt(q, le, v_id) || v_id < 0 || v_id >= nv) { failed = true; break; }
+
+                        if(i >= 2)
+                        {
+                            uint *t = tris.data() + 3 * t_off++;
+                            t[0] = static_cast<uint>(idx[0]);
+                            t[1] = static_cast<uint>(idx[1]);
+                            t[2] = static_cast<uint>(idx[2]);
+                            idx[1] = idx[2];
+                        }
+                    }
+                }
+                line++;
+            }
+            q = le +1;
+        }
+    });
+
+    if(failed)
+    {
+        coords.clear();
+        tris.clear();
+        return false;
+    }
+
+    return true;
+}
+
+//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+namespace
+{
+
+struct FloatTripletHash
+{
+    size_t operator()(const std::array<float, 3> &k) const
+    {
+        uint32_t b[3];
+        std::memcpy(b, k.data(), sizeof(b));
+        return phmap::HashState().combine(0, b[0], b[1], b[2]);
+    }
+};
+
+// merges the corners (3 per triangle) having the same coordinates. Vertices are numbered in order of
+// first occurrence, so that the result does not depend on the scheduling
+void weldCorners(const std::vector<float> &corners, std::vector<double> &coords, std::vector<uint> &tris)
+{
+    uint num_corners = static_cast<uint>(corners.size() / 3);
+
+    auto key = [&](uint c)
+    {
+        // +0.0f turns -0 into +0, so that they are welded as in mergeDuplicatedVertices
+        return std::array<float, 3>{corners[3 * c] + 0.0f, corners[3 * c +1] + 0.0f, corners[3 * c +2] + 0.0f};
+    };
+
+    // first corner of each distinct position
+    phmap::parallel_flat_hash_map<std::array<float, 3>, uint, FloatTripletHash, std::equal_to<std::array<float, 3>>,
+                                  std::allocator<std::pair<const std::array<float, 3>, uint>>, 6, std::mutex> first_corner;
+    first_corner.reserve(num_corners / 4);
+
+    tbb::parallel_for((uint)0, num_corners, [&](uint c)
+    {
+        first_corner.lazy_emplace_l(key(c),
+                                    [c](auto &e) { if(c < e.second) e.second = c; },
+                                    [&](const auto &ctor) { ctor(key(c), c); });
+    });
+
+    std::vector<uint> rep(num_corners);
+    tbb::parallel_for((uint)0, num_corners, [&](uint c)
+    {
+        rep[c] = c; // a NaN coordinate never matches its own key: such corners are left unwelded
+        first_corner.if_contains(key(c), [&](const auto &e) { rep[c] = e.second; });
+    });
+
+    // vertex ids by prefix sum over the representative corners
+    std::vector<uint> v_id(num_corners);
+    uint num_verts = 0;
+    for(uint c = 0; c < num_corners; c++)
+        if(rep[c] == c) v_id[c] = num_verts++;
+
+    coords.resize(3 * num_verts);
+    tris.resize(num_corners);
+
+    tbb::parallel_for((uint)0, num_corners, [&](uint c)
+    {
+        if(rep[c] == c)
+            for(uint i = 0; i < 3; i++) coords[3 * v_id[c] + i] = corners[3 * c + i];
+
+        tris[c] = v_id[rep[c]];
+    });
+}
+
+} // namespace
+
+//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+bool fastReadSTL(const std::string &filename, std::vector<double> &coords, std::vector<uint> &tris, bool weld)
+{
+    coords.clear();
+    tris.clear();
+
+    MappedFile file(filename);
+    if(!file.isOpen() || file.size() < 84) return false;
+
+    // 80 bytes header, number of triangles, then 50 bytes per triangle: normal, 3 vertices (float32), attribute
+    uint32_t num_tris;
+    std::memcpy(&num_tris, file.data() + 80, sizeof(uint32_t));
+    if(std::endian::native == std::endian::big) num_tris = __builtin_bswap32(num_tris);
+
+    if(file.size() != 84 + 50 * static_cast<uint64_t>(num_tris)) return false; // ASCII, or truncated
+    if(3 * static_cast<uint64_t>(num_tris) >= UINT32_MAX) return false;
+
+    // vertex coordinates, packed
+    std::vector<float> corners(9 * static_cast<size_t>(num_tris));
+
+    tbb::parallel_for(tbb::blocked_range<uint>(0, num_tris), [&](const tbb::blocked_range<uint> &r)
+    {
+        for(uint t = r.begin(); t < r.end(); t++)
+            std::memcpy(corners.data() + 9 * static_cast<size_t>(t), file.data() + 84 + 50 * static_cast<size_t>(t) + 12, 9 * sizeof(float));
+
+        if(std::endian::native == std::endian::big)
+            for(size_t i = 9 * static_cast<size_t>(r.begin()); i < 9 * static_cast<size_t>(r.end()); i++)
+            {
+                uint32_t b;
+                std::memcpy(&b, &corners[i], sizeof(b));
+                b = __builtin_bswap32(b);
+                std::memcpy(&corners[i], &b, sizeof(b));
+            }
+    });
+
+    if(weld)
+    {
+        weldCorners(corners, coords, tris);
+        return true;
+    }
+
+    coords.resize(corners.size());
+    tris.resize(3 * static_cast<size_t>(num_tris));
+
+    // contiguous float -> double conversion, vectorized by the compiler
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, corners.size()), [&](const tbb::blocked_range<size_t> &r)
+    {
+        const float *src = corners.data();
+        double *dst = coords.data();
+        for(size_t i = r.begin(); i < r.end(); i++) dst[i] = static_cast<double>(src[i]);
+    });
+
+    tbb::parallel_for(tbb::blocked_range<uint>(0, (uint)tris.size()), [&](const tbb::blocked_range<uint> &r)
+    {
+        for(uint i = r.begin(); i < r.end(); i++) tris[i] = i;
+    });
+
+    return true;
+}
+
+//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+namespace
+{
+
+enum PLYType {PLY_INT8, PLY_UINT8, PLY_INT16, PLY_UINT16, PLY_INT32, PLY_UINT32, PLY_FLOAT32, PLY_FLOAT64, PLY_INVALID};
+
+PLYType plyType(const std::string &name)
+{
+    if(name == "char"   || name == "int8")    return PLY_INT8;
+    if(name == "uchar"  || name == "uint8")   return PLY_UINT8;
+    if(name == "short"  || name == "int16")   return PLY_INT16;
+    if(name == "ushort" || name == "uint16")  return PLY_UINT16;
+    if(name == "int"    || name == "int32")   return PLY_INT32;
+    if(name == "uint"   || name == "uint32")  return PLY_UINT32;
+    if(name == "float"  || name == "float32") return PLY_FLOAT32;
+    if(name == "double" || name == "float64") return PLY_FLOAT64;
+    return PLY_INVALID;
+}
+
+uint plySize(PLYType t)
+{
+    static const uint sizes[] = {1, 1, 2, 2, 4, 4, 4, 8, 0};
+    return sizes[t];
+}
+
+template<typename T>
+inline T plyLoad(const char *p, bool swap)
+{
+    unsigned char b[sizeof(T)];
+    std::memcpy(b, p, sizeof(T));
+    if(swap) for(uint i = 0; i < sizeof(T) / 2; i++) std::swap(b[i], b[sizeof(T) -1 -i]);
+    T v;
+    std::memcpy(&v, b, sizeof(T));
+    return v;
+}
+
+inline double plyRead(const char *p, PLYType t, bool swap)
+{
+    switch(t)
+    {
+        case PLY_INT8:    return plyLoad<int8_t>(p, swap);
+        case PLY_UINT8:   return plyLoad<uint8_t>(p, swap);
+        case PLY_INT16:   return plyLoad<int16_t>(p, swap);
+        case PLY_UINT16:  return plyLoad<uint16_t>(p, swap);
+        case PLY_INT32:   return plyLoad<int32_t>(p, swap);
+        case PLY_UINT32:  return plyLoad<uint32_t>(p, swap);
+        case PLY_FLOAT32: return plyLoad<float>(p, swap);
+        case PLY_FLOAT64: return plyLoad<double>(p, swap);
+        default:          return 0.0;
+    }
+}
+
+struct PLYProperty
+{
+    std::string name;
+    PLYType     type       = PLY_INVALID;
+    PLYType     count_type = PLY_INVALID; // list properties only
+    bool        is_list    = false;
+};
+
+struct PLYElement
+{
+    std::string              name;
+    uint64_t                 count = 0;
+    std::vector<PLYProperty> props;
+
+    // size of a record if there are no lists, 0 otherwise
+    uint fixedSize() const
+    {
+        uint size = 0;
+        for(const PLYProperty &p : props)
+        {
+            if(p.is_list) return 0;
+            size += plySize(p.type);
+        }
+        return size;
+    }
+};
+
+// fastReadPLY, which clears coords and tris if this fails halfway
+bool parsePLY(const std::string &filename, std::vector<double> &coords, std::vector<uint> &tris)
+{
+    MappedFile file(filename);
+    if(!file.isOpen()) return false;
+
+    // header
+    const char *p = file.begin(), *end = file.end();
+    std::vector<PLYElement> elements;
+    bool swap = false;
+    bool header_end = false;
+
+    for(uint line_id = 0; p < end && !header_end; line_id++)
+    {
+        const char *le = lineEnd(p, end);
+        std::istringstream line(std::string(p, le));
+        p = (le < end) ? le +1 : le;
+
+        std::string key;
+        line >> key;
+
+        if(line_id == 0)
+        {
+            if(key != "ply") return false;
+        }
+        else if(key == "format")
+        {
+            std::string format;
+            line >> format;
+            if(format == "binary_little_endian")   swap = (std::endian::native != std::endian::little);
+            else if(format == "binary_big_endian") swap = (std::endian::native != std::endian::big);
+            else return false; // ascii
+        }
+        else if(key == "element")
+        {
+            PLYElement e;
+            line >> e.name >> e.count;
+            elements.push_back(e);
+        }
+        else if(key == "property")
+        {
+            if(elements.empty()) return false;
+
+            PLYProperty prop;
+            std::string type;
+            line >> type;
+            if(type == "list")
+            {
+                std::string count_type, item_type;
+                line >> count_type >> item_type;
+                prop.is_list    = true;
+                prop.count_type = plyType(count_type);
+                prop.type       = plyType(item_type);
+                if(prop.count_type == PLY_INVALID) return false;
+            }
+            else prop.type = plyType(type);
+
+            if(prop.type == PLY_INVALID) return false;
+            line >> prop.name;
+            elements.back().props.push_back(prop);
+        }
+        else if(key == "end_header") header_end = true;
+        else if(key != "comment" && key != "obj_info" && !key.empty()) return false;
+    }
+
+    if(!header_end) return false;
+
+    // faces may come before the vertices: their indices are checked against the count in the header
+    uint64_t num_verts = 0;
+    for(const PLYElement &e : elements) if(e.name == "vertex") num_verts = e.count;
+
+    // body, element after element
+    for(const PLYElement &e : elements)
+    {
+        uint fixed_size = e.fixedSize();
+
+        if(e.name == "vertex")
+        {
+            if(fixed_size == 0 || e.count >= UINT32_MAX) return false;
+            if(static_cast<uint64_t>(end - p) < e.count * fixed_size) return false;
+
+            int xyz_off[3] = {-1, -1, -1};
+            PLYType xyz_type[3];
+            uint off = 0;
+            for(const PLYProperty &prop : e.props)
+            {
+                int axis = (prop.name == "x") ? 0 : (prop.name == "y") ? 1 : (prop.name == "z") ? 2 : -1;
+                if(axis >= 0)
+                {
+                    xyz_off[axis]  = static_cast<int>(off);
+                    xyz_type[axis] = prop.type;
+                }
+                off += plySize(prop.type);
+            }
+            if(xyz_off[0] < 0 || xyz_off[1] < 0 || xyz_off[2] < 0) return false;
+
+            coords.resize(3 * e.count);
+            const char *base = p;
+
+            tbb::parallel_for(tbb::blocked_range<uint>(0, (uint)e.count), [&](const tbb::blocked_range<uint> &r)
+            {
+                for(uint v = r.begin(); v < r.end(); v++)
+                {
+                    const char *rec = base + static_cast<size_t>(v) * fixed_size;
+                    for(uint i = 0; i < 3; i++) coords[3 * v + i] = plyRead(rec + xyz_off[i], xyz_type[i], swap);
+                }
+            });
+
+            p += e.count * fixed_size;
+        }
+        else if(e.name == "face")
+        {
+            // the list of vertex indices, possibly with scalar properties before and after it
+            int list_id = -1;
+            uint before = 0, after = 0;
+            for(uint i = 0; i < e.props.size(); i++)
+            {
+                const PLYProperty &prop = e.props[i];
+                if(prop.is_list && (prop.name == "vertex_indices" || prop.name == "vertex_index") && list_id < 0) list_id = static_cast<int>(i);
+                else if(prop.is_list) return false;
+                else if(list_id < 0) before += plySize(prop.type);
+                else                 after  += plySize(prop.type);
+            }
+            if(list_id < 0) return false;
+
+            const PLYProperty &list = e.props[list_id];
+            uint count_size = plySize(list.count_type), index_size = plySize(list.type);
+
+            // offset and number of triangles of each face. All triangles (the common case) means a fixed stride
+            uint tri_stride = before + count_size + 3 * index_size + after;
+            const char *base = p;
+
+            std::atomic<bool> all_tris(static_cast<uint64_t>(end - p) >= e.count * tri_stride);
+            if(all_tris)
+            {
+                tbb::parallel_for(tbb::blocked_range<uint>(0, (uint)e.count), [&](const tbb::blocked_range<uint> &r)
+                {
+                    for(uint f = r.begin(); f < r.end() && all_tris; f++)
+                        if(plyRead(base + static_cast<size_t>(f) * tri_stride + before, list.count_type, swap) != 3.0) all_tris = false;
+                });
+            }
+
+            std::vector<uint64_t> face_off, face_tri;
+            uint64_t num_tris = e.count;
+
+            if(!all_tris)
+            {
+                face_off.resize(e.count);
+                face_tri.resize(e.count);
+                num_tris = 0;
+
+                const char *q = p;
+                for(uint64_t f = 0; f < e.count; f++)
+                {
+                    if(q + before + count_size > end) return false;
+                    double n = plyRead(q + before, list.count_type, swap);
+                    if(!(n >= 3 && n <= UINT32_MAX && n == std::floor(n))) return false; // also rejects NaN
+
+                    face_off[f] = q - base;
+                    face_tri[f] = num_tris;
+                    num_tris += static_cast<uint64_t>(n) - 2;
+                    q += before + count_size + static_cast<uint64_t>(n) * index_size + after;
+                }
+                if(q > end) return false;
+            }
+
+            if(3 * num_tris >= UINT32_MAX) return false;
+            tris.resize(3 * num_tris);
+
+            // indices are read as double: the negative, fractional or out of range ones are rejected
+            // before the conversion, which would be undefined for them
+            std::atomic<bool> valid_indices(true);
+            auto index = [&](const char *q)
+            {
+                double i = plyRead(q, list.type, swap);
+                if(i >= 0 && i < static_cast<double>(num_verts) && i == std::floor(i)) return static_cast<uint>(i);
+                valid_indices = false;
+                return 0u;
+            };
+
+            tbb::parallel_for(tbb::blocked_range<uint>(0, (uint)e.count), [&](const tbb::blocked_range<uint> &r)
+            {
+                for(uint f = r.begin(); f < r.end(); f++)
+                {
+                    const char *rec = base + ((all_tris) ? static_cast<size_t>(f) * tri_stride : face_off[f]) + before;
+                    uint n = static_cast<uint>(plyRead(rec, list.count_type, swap));
+                    const char *idx = rec + count_size;
+                    uint *t = tris.data() + 3 * ((all_tris) ? static_cast<size_t>(f) : face_tri[f]);
+
+                    uint first = index(idx);
+                    uint prev  = index(idx + index_size);
+                    for(uint i = 2; i < n; i++, t += 3)
+                    {
+                        uint curr = index(idx + i * index_size);
+                        t[0] = first;
+                        t[1] = prev;
+                        t[2] = curr;
+                        prev = curr;
+                    }
+                }
+            });
+            if(!valid_indices) return false;
+
+            p = (all_tris) ? p + e.count * tri_stride : base + face_off.back() + before + count_size +
+                             static_cast<uint64_t>(plyRead(base + face_off.back() + before, list.count_type, swap)) * index_size + after;
+        }
+        else
+        {
+            // other elements are skipped, as long as their size is known without parsing them
+            if(fixed_size == 0) return false;
+            p += e.count * fixed_size;
+        }
+
+        if(p > end) return false;
+    }
+
+    return true;
+}
+
+} // namespace
+
+//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+bool fastReadPLY(const std::string &filename, std::vector<double> &coords, std::vector<uint> &tris)
+{
+    coords.clear();
+    tris.clear();
+
+    if(parsePLY(filename, coords, tris)) return true;
+
+    coords.clear();
+    tris.clear();
+    return false;
+}
@@ -0,0 +1,65 @@
+/*****************************************************************************************
+ *              MIT License                                                              *
+ *                                                                                       *
+ * Copyright (c) 2020 Gianmarco Cherchi, Marco Livesu, Riccardo Scateni e Marco Attene   *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION     *
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        *
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                *
+ *                                                                                       *
+ * Authors:                                                                              *
+ *      Gianmarco Cherchi (g.cherchi@unica.it)                                           *
+ *      https://people.unica.it/gianmarcocherchi/                                        *
+ *                                                                                       *
+ *      Marco Livesu (marco.livesu@ge.imati.cnr.it)                                      *
+ *      http://pers.ge.imati.cnr.it/livesu/                                              *
+ *                                                                                       *
+ *      Riccardo Scateni (riccardo@unica.it)                                             *
+ *      https://people.unica.it/riccardoscateni/                                         *
+ *                                                                                       *
+ *      Marco Attene (marco.attene@ge.imati.cnr.it)                                      *
+ *      https://www.cnr.it/en/people/marco.attene/                                       *
+ *                                                                                       *
+ * ***************************************************************************************/
+
+#ifndef FAST_READERS_H
+#define FAST_READERS_H
+
+#include <string>
+#include <vector>
+
+typedef unsigned int uint;
+
+// Native mesh readers: the file is memory mapped, split in chunks at line boundaries and parsed
+// in parallel, writing straight into the flat coords/tris vectors (polygons are triangulated as fans).
+// Each reader returns false, with empty coords/tris, if the file cannot be opened or contains
+// something it does not support, so that the caller can fall back to the cinolib readers.
+
+bool fastReadOBJ(const std::string &filename, std::vector<double> &coords, std::vector<uint> &tris);
+
+// the header is expected as in cinolib::read_OFF (plain "OFF"), with one vertex or face per line
+bool fastReadOFF(const std::string &filename, std::vector<double> &coords, std::vector<uint> &tris);
+
+// binary STL. Triangles are stored unwelded in the file: if weld is set, the vertices with exactly the
+// same coordinates are merged while parsing (with a parallel hash), otherwise each triangle gets its own
+// three vertices. ASCII STL is not supported
+bool fastReadSTL(const std::string &filename, std::vector<double> &coords, std::vector<uint> &tris, bool weld = true);
+
+// binary (little or big endian) PLY, with vertex coordinates x,y,z of any scalar type and faces
+// stored in a list property named vertex_indices (or vertex_index). ASCII PLY is not supported
+bool fastReadPLY(const std::string &filename, std::vector<double> &coords, std::vector<uint> &tris);
+
+#endif // FAST_READERS_H
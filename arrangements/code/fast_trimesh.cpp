@@ -802,6 +802,31 @@ void FastTrimesh::flipTri(uint t_id)
     triangles[t_id].v[2] = tmp;
 }
 
+//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+void FastTrimesh::flipEdge(uint e_id)
+{
+    assert(e_id < edges.size() && "edge id out of range");
+    assert(e2t[e_id].size() == 2 && "edge is not manifold");
+    assert(!edges[e_id].constr && "constrained edge");
+
+    uint t0_id = e2t[e_id][0];
+    uint t1_id = e2t[e_id][1];
+
+    uint ev0_id = edges[e_id].v.first;
+    uint ev1_id = edges[e_id].v.second;
+    if(!triVertsAreCCW(t0_id, ev1_id, ev0_id)) std::swap(ev0_id, ev1_id);
+
+    uint opp0_id = triVertOppositeTo(t0_id, ev0_id, ev1_id);
+    uint opp1_id = triVertOppositeTo(t1_id, ev0_id, ev1_id);
+
+    // t0 = (ev0, ev1, opp0) and t1 = (ev1, ev0, opp1) -> (ev0, opp1, opp0) and (opp1, ev1, opp0)
+    addTri(ev0_id, opp1_id, opp0_id);
+    addTri(opp1_id, ev1_id, opp0_id);
+
+    removeTris(e2t[e_id]);
+}
+
 /***********************************************************************************************
  *          PRIVATE METHODS
  * ********************************************************************************************/
@@ -207,6 +207,10 @@ class FastTrimesh
 
         void flipTri(uint t_id);
 
+        // replaces the edge shared by two triangles with the other diagonal of their quad.
+        // Edge and triangle ids are not preserved
+        void flipEdge(uint e_id);
+
     private:
         std::vector<iVtx>    vertices;
         std::vector<iEdge>   edges;
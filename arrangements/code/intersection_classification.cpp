@@ -97,14 +97,66 @@ void classifyIntersections(TriangleSoup &ts, point_arena& arena, AuxiliaryStruct
     auto& v_map = g.get_vmap();
     v_map.start_size = v_map.map.size();
     v_map.insert_tries = 0;
-    for(auto &pair : g.intersectionList())
+
+    // the orientations of each pair are computed a block of pairs at a time, so that the filter
+    // evaluates four determinants at once and only the uncertain ones go exact. As in
+    // checkTriangleTriangleIntersections, the orientations of tA wrt tB are computed only for the
+    // pairs where tB crosses the plane of tA without lying on it
+    const std::vector<std::pair<uint, uint> > &pairs = g.intersectionList();
+    const uint block_size = 64;
+    std::vector<const double *> p(3 * block_size), q(3 * block_size), r(3 * block_size), s(3 * block_size);
+    std::vector<int> orient(6 * block_size), or_batch(3 * block_size);
+    std::vector<uint> cross(block_size);
+
+    // cinolib::orient3d(v, t0, t1, t2) has the sign of orient3d(t2, v, t0, t1) in the indirect predicates
+    auto set_tuples = [&](uint k, uint v_tri, uint ref_tri)
     {
-        uint tA_id = pair.first, tB_id = pair.second;
+        for(uint j = 0; j < 3; j++)
+        {
+            p[3 * k + j] = ts.triVertPtr(ref_tri, 2);
+            q[3 * k + j] = ts.triVertPtr(v_tri, j);
+            r[3 * k + j] = ts.triVertPtr(ref_tri, 0);
+            s[3 * k + j] = ts.triVertPtr(ref_tri, 1);
+        }
+    };
+
+    for(uint b_start = 0; b_start < pairs.size(); b_start += block_size)
+    {
+        uint b_size = std::min(block_size, static_cast<uint>(pairs.size()) - b_start);
+
+        // tB wrt tA
+        for(uint i = 0; i < b_size; i++) set_tuples(i, pairs[b_start + i].second, pairs[b_start + i].first);
+
+        orient3dBatch(p.data(), q.data(), r.data(), s.data(), or_batch.data(), 3 * b_size);
+
+        uint num_cross = 0;
+        for(uint i = 0; i < b_size; i++)
+        {
+            const int *o = &or_batch[3 * i];
+            std::copy(o, o + 3, &orient[6 * i]);
+            std::fill(&orient[6 * i + 3], &orient[6 * i + 6], 0);
+
+            bool separated = (o[0] == o[1] && o[1] == o[2] && o[0] != 0);
+            bool coplanar  = (o[0] == 0 && o[1] == 0 && o[2] == 0);
+            if(!separated && !coplanar) cross[num_cross++] = i;
+        }
+
+        // tA wrt tB
+        for(uint k = 0; k < num_cross; k++) set_tuples(k, pairs[b_start + cross[k]].first, pairs[b_start + cross[k]].second);
+
+        orient3dBatch(p.data(), q.data(), r.data(), s.data(), or_batch.data(), 3 * num_cross);
 
-        g.setTriangleHasIntersections(tA_id);
-        g.setTriangleHasIntersections(tB_id);
+        for(uint k = 0; k < num_cross; k++) std::copy(&or_batch[3 * k], &or_batch[3 * k + 3], &orient[6 * cross[k] + 3]);
 
-        checkTriangleTriangleIntersections(ts, arena, g, tA_id, tB_id);
+        for(uint i = 0; i < b_size; i++)
+        {
+            uint tA_id = pairs[b_start + i].first, tB_id = pairs[b_start + i].second;
+
+            g.setTriangleHasIntersections(tA_id);
+            g.setTriangleHasIntersections(tB_id);
+
+            checkTriangleTriangleIntersections(ts, arena, g, tA_id, tB_id, &orient[6 * i]);
+        }
     }
 
     // Coplanar triangles intersections propagation
@@ -113,7 +165,7 @@ void classifyIntersections(TriangleSoup &ts, point_arena& arena, AuxiliaryStruct
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
-void checkTriangleTriangleIntersections(TriangleSoup &ts, point_arena& arena, AuxiliaryStructure &g, uint tA_id, uint tB_id)
+void checkTriangleTriangleIntersections(TriangleSoup &ts, point_arena& arena, AuxiliaryStructure &g, uint tA_id, uint tB_id, const int orient[])
 {
     phmap::flat_hash_set<uint> v_tmp; // temporary vtx list for final symbolic edge creation
     bool coplanar_tris = false;
@@ -123,10 +175,9 @@ void checkTriangleTriangleIntersections(TriangleSoup &ts, point_arena& arena, Au
      *      check of tB respect to tA
      * :::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: */
     double orBA[3];
-    orBA[0] = cinolib::orient3d(ts.triVertPtr(tB_id, 0), ts.triVertPtr(tA_id, 0), ts.triVertPtr(tA_id, 1), ts.triVertPtr(tA_id, 2));
-    orBA[1] = cinolib::orient3d(ts.triVertPtr(tB_id, 1), ts.triVertPtr(tA_id, 0), ts.triVertPtr(tA_id, 1), ts.triVertPtr(tA_id, 2));
-    orBA[2] = cinolib::orient3d(ts.triVertPtr(tB_id, 2), ts.triVertPtr(tA_id, 0), ts.triVertPtr(tA_id, 1), ts.triVertPtr(tA_id, 2));
-    normalizeOrientations(orBA);
+    orBA[0] = orient[0];
+    orBA[1] = orient[1];
+    orBA[2] = orient[2];
 
     if(sameOrientation(orBA[0], orBA[1]) && sameOrientation(orBA[1], orBA[2]) && (orBA[0] != 0.0)) return;   //no intersection found
 
@@ -202,10 +253,9 @@ void checkTriangleTriangleIntersections(TriangleSoup &ts, point_arena& arena, Au
     }
     else
     {
-        orAB[0] = cinolib::orient3d(ts.triVertPtr(tA_id, 0), ts.triVertPtr(tB_id, 0), ts.triVertPtr(tB_id, 1), ts.triVertPtr(tB_id, 2));
-        orAB[1] = cinolib::orient3d(ts.triVertPtr(tA_id, 1), ts.triVertPtr(tB_id, 0), ts.triVertPtr(tB_id, 1), ts.triVertPtr(tB_id, 2));
-        orAB[2] = cinolib::orient3d(ts.triVertPtr(tA_id, 2), ts.triVertPtr(tB_id, 0), ts.triVertPtr(tB_id, 1), ts.triVertPtr(tB_id, 2));
-        normalizeOrientations(orAB);
+        orAB[0] = orient[3];
+        orAB[1] = orient[4];
+        orAB[2] = orient[5];
 
         if(sameOrientation(orAB[0], orAB[1]) && sameOrientation(orAB[1], orAB[2]) && (orAB[0] != 0.0)) return;   //no intersection
     }
@@ -277,11 +327,11 @@ uint addEdgeCrossEdgeInters(TriangleSoup &ts, point_arena& arena, uint e0_id, ui
                                                ts.edgeVertPtr(e1_id, 1),
                                                ts.edgeVertPtr(e0_id, 0));
 
-    implicitPoint3D_LPI *tmp_i = &arena.edges.emplace_back(ts.edgeVert(e0_id, 0)->toExplicit3D(),
-                                                           ts.edgeVert(e0_id, 1)->toExplicit3D(),
-                                                           ts.edgeVert(e1_id, 0)->toExplicit3D(),
-                                                           ts.edgeVert(e1_id, 1)->toExplicit3D(),
-                                                           ts.jollyPoint(jolly_id)->toExplicit3D());
+    genericPoint *tmp_i = newLPI(arena, ts.edgeVert(e0_id, 0)->toExplicit3D(),
+                                        ts.edgeVert(e0_id, 1)->toExplicit3D(),
+                                        ts.edgeVert(e1_id, 0)->toExplicit3D(),
+                                        ts.edgeVert(e1_id, 1)->toExplicit3D(),
+                                        ts.jollyPoint(jolly_id)->toExplicit3D());
 
     uint new_v_id;
     uint pos = ts.numVerts();
@@ -298,7 +348,7 @@ uint addEdgeCrossEdgeInters(TriangleSoup &ts, point_arena& arena, uint e0_id, ui
     else // already present vertex
     {
         new_v_id = ins.first;
-        arena.edges.pop_back();
+        popLPI(arena);
     }
 
     g.addVertexInEdge(e0_id, new_v_id);
@@ -311,11 +361,11 @@ uint addEdgeCrossEdgeInters(TriangleSoup &ts, point_arena& arena, uint e0_id, ui
 
 uint addEdgeCrossEdgeInters(TriangleSoup &ts, point_arena& arena, uint e0_id, uint e1_id, uint t_id, AuxiliaryStructure &g)
 {
-    implicitPoint3D_LPI *tmp_i = &arena.edges.emplace_back(ts.edgeVert(e0_id, 0)->toExplicit3D(),
-                                                           ts.edgeVert(e0_id, 1)->toExplicit3D(),
-                                                           ts.triVert(t_id, 0)->toExplicit3D(),
-                                                           ts.triVert(t_id, 1)->toExplicit3D(),
-                                                           ts.triVert(t_id, 2)->toExplicit3D());
+    genericPoint *tmp_i = newLPI(arena, ts.edgeVert(e0_id, 0)->toExplicit3D(),
+                                        ts.edgeVert(e0_id, 1)->toExplicit3D(),
+                                        ts.triVert(t_id, 0)->toExplicit3D(),
+                                        ts.triVert(t_id, 1)->toExplicit3D(),
+                                        ts.triVert(t_id, 2)->toExplicit3D());
 
     uint new_v_id;
     uint pos = ts.numVerts();
@@ -332,7 +382,7 @@ uint addEdgeCrossEdgeInters(TriangleSoup &ts, point_arena& arena, uint e0_id, ui
     else // already present vertex
     {
         new_v_id = ins.first;
-        arena.edges.pop_back();
+        popLPI(arena);
     }
 
     g.addVertexInEdge(e0_id, new_v_id);
@@ -345,11 +395,11 @@ uint addEdgeCrossEdgeInters(TriangleSoup &ts, point_arena& arena, uint e0_id, ui
 
 uint addEdgeCrossTriInters(TriangleSoup &ts, point_arena& arena, uint e_id, uint t_id, AuxiliaryStructure &g)
 {
-    implicitPoint3D_LPI *tmp_i = &arena.edges.emplace_back(ts.edgeVert(e_id, 0)->toExplicit3D(),
-                                                         ts.edgeVert(e_id, 1)->toExplicit3D(),
-                                                         ts.triVert(t_id, 0)->toExplicit3D(),
-                                                         ts.triVert(t_id, 1)->toExplicit3D(),
-                                                         ts.triVert(t_id, 2)->toExplicit3D());
+    genericPoint *tmp_i = newLPI(arena, ts.edgeVert(e_id, 0)->toExplicit3D(),
+                                        ts.edgeVert(e_id, 1)->toExplicit3D(),
+                                        ts.triVert(t_id, 0)->toExplicit3D(),
+                                        ts.triVert(t_id, 1)->toExplicit3D(),
+                                        ts.triVert(t_id, 2)->toExplicit3D());
     uint new_v_id;
     uint pos = ts.numVerts();
     std::pair<uint, bool> ins = g.addVertexInSortedList(tmp_i, pos); // check if the intersection already exists
@@ -365,7 +415,7 @@ uint addEdgeCrossTriInters(TriangleSoup &ts, point_arena& arena, uint e_id, uint
     else // already present vertex
     {
         new_v_id = ins.first;
-        arena.edges.pop_back();
+        popLPI(arena);
     }
 
     g.addVertexInTriangle(t_id, new_v_id);
@@ -897,43 +947,23 @@ int vtxOnASideAndOppositeEdgeOnTheOther(const double o[], uint &opp_v0, uint &op
 bool genericPointInsideTriangle(const TriangleSoup &ts, uint p_id, uint t_id, const bool &strict)
 {
     const genericPoint *p = ts.vert(p_id);
-    const genericPoint *tv0 = ts.triVert(t_id, 0);
-    const genericPoint *tv1 = ts.triVert(t_id, 1);
-    const genericPoint *tv2 = ts.triVert(t_id, 2);
+    const genericPoint *tv[3] = {ts.triVert(t_id, 0), ts.triVert(t_id, 1), ts.triVert(t_id, 2)};
+    const genericPoint *tv_next[3] = {tv[1], tv[2], tv[0]};
+    const genericPoint *pp[3] = {p, p, p};
 
+    // orientation of p with respect to the three edges, filtered in a single batch
+    int orient[3];
     switch (ts.triPlane(t_id))
     {
-        case XY:
-        {
-            if(strict)
-                return ((genericPoint::orient2Dxy(*tv0, *tv1, *p) > 0 && genericPoint::orient2Dxy(*tv1, *tv2, *p) > 0 && genericPoint::orient2Dxy(*tv2, *tv0, *p) > 0) ||
-                        (genericPoint::orient2Dxy(*tv0, *tv1, *p) < 0 && genericPoint::orient2Dxy(*tv1, *tv2, *p) < 0 && genericPoint::orient2Dxy(*tv2, *tv0, *p) < 0));
-            else
-                return ((genericPoint::orient2Dxy(*tv0, *tv1, *p) >= 0 && genericPoint::orient2Dxy(*tv1, *tv2, *p) >= 0 && genericPoint::orient2Dxy(*tv2, *tv0, *p) >= 0) ||
-                        (genericPoint::orient2Dxy(*tv0, *tv1, *p) <= 0 && genericPoint::orient2Dxy(*tv1, *tv2, *p) <= 0 && genericPoint::orient2Dxy(*tv2, *tv0, *p) <= 0));
-        }
-
-        case YZ:
-        {
-            if(strict)
-                return ((genericPoint::orient2Dyz(*tv0, *tv1, *p) > 0 && genericPoint::orient2Dyz(*tv1, *tv2, *p) > 0 && genericPoint::orient2Dyz(*tv2, *tv0, *p) > 0) ||
-                        (genericPoint::orient2Dyz(*tv0, *tv1, *p) < 0 && genericPoint::orient2Dyz(*tv1, *tv2, *p) < 0 && genericPoint::orient2Dyz(*tv2, *tv0, *p) < 0));
-            else
-                return ((genericPoint::orient2Dyz(*tv0, *tv1, *p) >= 0 && genericPoint::orient2Dyz(*tv1, *tv2, *p) >= 0 && genericPoint::orient2Dyz(*tv2, *tv0, *p) >= 0) ||
-                        (genericPoint::orient2Dyz(*tv0, *tv1, *p) <= 0 && genericPoint::orient2Dyz(*tv1, *tv2, *p) <= 0 && genericPoint::orient2Dyz(*tv2, *tv0, *p) <= 0));
-        }
-
-        case ZX:
-        {
-            if(strict)
-                return ((genericPoint::orient2Dzx(*tv0, *tv1, *p) > 0 && genericPoint::orient2Dzx(*tv1, *tv2, *p) > 0 && genericPoint::orient2Dzx(*tv2, *tv0, *p) > 0) ||
-                        (genericPoint::orient2Dzx(*tv0, *tv1, *p) < 0 && genericPoint::orient2Dzx(*tv1, *tv2, *p) < 0 && genericPoint::orient2Dzx(*tv2, *tv0, *p) < 0));
-            else
-                return ((genericPoint::orient2Dzx(*tv0, *tv1, *p) >= 0 && genericPoint::orient2Dzx(*tv1, *tv2, *p) >= 0 && genericPoint::orient2Dzx(*tv2, *tv0, *p) >= 0) ||
-                        (genericPoint::orient2Dzx(*tv0, *tv1, *p) <= 0 && genericPoint::orient2Dzx(*tv1, *tv2, *p) <= 0 && genericPoint::orient2Dzx(*tv2, *tv0, *p) <= 0));
-        }
+        case XY: genericPoint::orient2DxyBatch(tv, tv_next, pp, orient, 3); break;
+        case YZ: genericPoint::orient2DyzBatch(tv, tv_next, pp, orient, 3); break;
+        case ZX: genericPoint::orient2DzxBatch(tv, tv_next, pp, orient, 3); break;
     }
 
+    if(strict)
+        return ((orient[0] > 0 && orient[1] > 0 && orient[2] > 0) || (orient[0] < 0 && orient[1] < 0 && orient[2] < 0));
+    else
+        return ((orient[0] >= 0 && orient[1] >= 0 && orient[2] >= 0) || (orient[0] <= 0 && orient[1] <= 0 && orient[2] <= 0));
 }
 
 
@@ -55,7 +55,9 @@ void detectIntersections(const TriangleSoup &ts, std::vector<std::pair<uint, uin
 
 void classifyIntersections(TriangleSoup &ts, point_arena& arena, AuxiliaryStructure &g);
 
-void checkTriangleTriangleIntersections(TriangleSoup &ts, point_arena& arena, AuxiliaryStructure &g, uint tA_id, uint tB_id);
+// orient holds the signs of cinolib::orient3d for the vertices of tB wrt tA (0..2) and for the vertices of tA wrt tB (3..5).
+// The latter are read only if tB crosses the plane of tA without lying on it
+void checkTriangleTriangleIntersections(TriangleSoup &ts, point_arena& arena, AuxiliaryStructure &g, uint tA_id, uint tB_id, const int orient[]);
 
 uint addEdgeCrossEdgeInters(TriangleSoup &ts, point_arena& arena, uint e0_id, uint e1_id, AuxiliaryStructure &g);
 
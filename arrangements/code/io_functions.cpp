@@ -36,108 +36,132 @@
  * ***************************************************************************************/
 
 #include "io_functions.h"
+#include "fast_readers.h"
 
 #include <cinolib/octree.h>
+#include <fstream>
+#include <mutex>
+#include <stdexcept>
+
+namespace
+{
+// the cinolib readers call setlocale, which is not thread safe: the fallbacks of load()
+// are run one at a time, so that loadMultipleFiles can parse the files concurrently
+std::mutex cinolib_readers_mutex;
+}
 
 void load(const std::string &filename, std::vector<double> &coords, std::vector<uint> &tris)
 {
     std::vector<cinolib::vec3d> tmp_verts;
 
-    std::string filetype = filename.substr(filename.size() - 4, 4);
+    // the cinolib readers exit if they cannot open the file, here the error is thrown to the caller instead
+    if(!std::ifstream(filename).good()) throw std::runtime_error("load() : couldn't open input file " + filename);
 
+    std::string filetype = (filename.size() >= 4) ? filename.substr(filename.size() - 4, 4) : std::string();
+
+    // the native readers handle the common cases, cinolib the rest
     if (filetype.compare(".off") == 0 || filetype.compare(".OFF") == 0)
     {
+        if(fastReadOFF(filename, coords, tris)) return;
+
+        std::lock_guard<std::mutex> lock(cinolib_readers_mutex);
         std::vector< std::vector<uint> > tmp_tris;
         cinolib::read_OFF(filename.c_str(), tmp_verts, tmp_tris);
         tris = cinolib::serialized_vids_from_polys(tmp_tris);
     }
     else if (filetype.compare(".obj") == 0 || filetype.compare(".OBJ") == 0)
     {
+        if(fastReadOBJ(filename, coords, tris)) return;
+
+        std::lock_guard<std::mutex> lock(cinolib_readers_mutex);
         std::vector< std::vector<uint> > tmp_tris;
         cinolib::read_OBJ(filename.c_str(), tmp_verts, tmp_tris);
         tris = cinolib::serialized_vids_from_polys(tmp_tris);
     }
     else if (filetype.compare(".stl") == 0 || filetype.compare(".STL") == 0)
     {
+        if(fastReadSTL(filename, coords, tris)) return;
+
+        std::lock_guard<std::mutex> lock(cinolib_readers_mutex);
         cinolib::read_STL(filename.c_str(), tmp_verts, tris, false);
     }
-    else
+    else if (filetype.compare(".ply") == 0 || filetype.compare(".PLY") == 0)
     {
-        std::cerr << "ERROR: file format not supported yet " << std::endl;
+        if(fastReadPLY(filename, coords, tris)) return;
+
+        throw std::runtime_error("load() : only binary PLY files are supported " + filename);
     }
+    else throw std::runtime_error("load() : file format not supported yet " + filename);
 
     coords = cinolib::serialized_xyz_from_vec3d(tmp_verts);
 }
 
 //:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
-void loadMultipleFiles(const std::vector<std::string> &files, std::vector<double> &coords, std::vector<uint> &tris, std::vector<uint> &labels)
+void loadMultipleFiles(const std::vector<std::string> &files, std::vector<double> &coords, std::vector<uint> &tris, std::vector<uint> &labels, bool parallel)
 {
-    for(uint f_id = 0; f_id < files.size(); f_id++)
-    {
-        std::vector<double> tmp_coords;
-        std::vector<uint> tmp_tris;
-
-        load(files[f_id], tmp_coords, tmp_tris);
-
-        /*if (f_id == 0) {
-            
-
-            for (int i = 0; i < tmp_coords.size(); i++) {
-                tmp_coords[i] /= 7.0;
-            }
+    int vert_offset;
+    loadMultipleFiles(files, coords, tris, labels, vert_offset, parallel);
+}
 
-            for (int i = 0; i < tmp_coords.size() / 3; i++) {
-                tmp_coords[i * 3 + 0] -= 16.0;
-                tmp_coords[i * 3 + 1] -= 21.0;
-                tmp_coords[i * 3 + 2] += 1.0;
-            }
-            
-        }*/
-        /*if (f_id == 1) {
+void loadMultipleFiles(const std::vector<std::string> &files, std::vector<double> &coords, std::vector<uint> &tris, std::vector<uint> &labels, int &vert_offset, bool parallel)
+{
+    uint num_files = static_cast<uint>(files.size());
+    if(num_files == 0) return;
 
-            for (int i = 0; i < tmp_coords.size(); i++) {
-                tmp_coords[i] *= 2.0;
-            }
-        }*/
+    std::vector< std::vector<double> > f_coords(num_files);
+    std::vector< std::vector<uint> > f_tris(num_files);
 
-        uint off = static_cast<uint>(coords.size() / 3); // prev num verts
-
-        coords.insert(coords.end(), tmp_coords.begin(), tmp_coords.end());
+    if(parallel)
+    {
+        tbb::parallel_for((uint)0, num_files, [&](uint f_id)
+        {
+            load(files[f_id], f_coords[f_id], f_tris[f_id]);
+        });
+    }
+    else
+    {
+        for(uint f_id = 0; f_id < num_files; f_id++)
+            load(files[f_id], f_coords[f_id], f_tris[f_id]);
+    }
 
-        for(auto &i : tmp_tris) tris.push_back(i + off);
+    // where each file goes in the output (appended to what is already there), by prefix sum
+    std::vector<size_t> c_off(num_files +1), t_off(num_files +1), l_off(num_files +1);
+    c_off[0] = coords.size();
+    t_off[0] = tris.size();
+    l_off[0] = labels.size();
 
-        for(uint i = 0; i < tmp_tris.size() / 3; i++)
-            labels.push_back(f_id);
+    for(uint f_id = 0; f_id < num_files; f_id++)
+    {
+        c_off[f_id +1] = c_off[f_id] + f_coords[f_id].size();
+        t_off[f_id +1] = t_off[f_id] + f_tris[f_id].size();
+        l_off[f_id +1] = l_off[f_id] + f_tris[f_id].size() / 3;
     }
-}
 
-//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+    vert_offset = static_cast<int>(c_off[num_files -1]);
 
-void loadMultipleFiles(const std::vector<std::string> &files, std::vector<double> &coords, std::vector<uint> &tris, std::vector<uint> &labels, int &vert_offset)
-{
-    for(uint f_id = 0; f_id < files.size(); f_id++)
-    {
-        vert_offset = coords.size();
+    coords.resize(c_off[num_files]);
+    tris.resize(t_off[num_files]);
+    labels.resize(l_off[num_files]);
 
-        std::vector<double> tmp_coords;
-        std::vector<uint> tmp_tris;
+    auto fill = [&](uint f_id)
+    {
+        uint off = static_cast<uint>(c_off[f_id] / 3); // prev num verts
 
-        load(files[f_id], tmp_coords, tmp_tris);
+        std::copy(f_coords[f_id].begin(), f_coords[f_id].end(), coords.begin() + c_off[f_id]);
 
-        uint off = static_cast<uint>(coords.size() / 3); // prev num verts
+        for(size_t i = 0; i < f_tris[f_id].size(); i++) tris[t_off[f_id] + i] = f_tris[f_id][i] + off;
 
-        coords.insert(coords.end(), tmp_coords.begin(), tmp_coords.end());
+        std::fill(labels.begin() + l_off[f_id], labels.begin() + l_off[f_id +1], f_id);
 
-        for(auto &i : tmp_tris) tris.push_back(i + off);
+        std::vector<double>().swap(f_coords[f_id]);
+        std::vector<uint>().swap(f_tris[f_id]);
+    };
 
-        for(uint i = 0; i < tmp_tris.size() / 3; i++)
-            labels.push_back(f_id);
-    }
+    if(parallel) tbb::parallel_for((uint)0, num_files, fill);
+    else for(uint f_id = 0; f_id < num_files; f_id++) fill(f_id);
 }
 
-//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
-
 void loadMultipleFilesWithVertFix(const std::vector<std::string> &files, std::vector<double> &coords, std::vector<uint> &tris, std::vector<uint> &labels)
 {
     for(uint f_id = 0; f_id < files.size(); f_id++)
@@ -232,6 +256,47 @@ void save(const std::string &filename, std::vector<double> &coords, std::vector<
 
 //:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
+// writes the explicit vertex ids defining an LPI point (either implicitPoint3D_LPI or implicitPoint3D_IDX)
+template<typename LPI_point>
+void writeLPI(FILE *fp, const LPI_point &p, const std::map<std::tuple<double, double, double>, uint> &v_map)
+{
+    const explicitPoint3D &ep = p.P();   std::tuple<double,double,double> tp(ep.X(), ep.Y(), ep.Z());
+    const explicitPoint3D &eq = p.Q();   std::tuple<double,double,double> tq(eq.X(), eq.Y(), eq.Z());
+    const explicitPoint3D &er = p.R();   std::tuple<double,double,double> tr(er.X(), er.Y(), er.Z());
+    const explicitPoint3D &es = p.S();   std::tuple<double,double,double> ts(es.X(), es.Y(), es.Z());
+    const explicitPoint3D &et = p.T();   std::tuple<double,double,double> tt(et.X(), et.Y(), et.Z());
+
+    uint id_p = v_map.find(tp)->second;     uint id_q = v_map.find(tq)->second;
+    uint id_r = v_map.find(tr)->second;     uint id_s = v_map.find(ts)->second;     uint id_t = v_map.find(tt)->second;
+
+    fprintf(fp, "l %d %d %d %d %d\n", id_p, id_q, id_r, id_s, id_t);
+}
+
+//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// writes the explicit vertex ids defining a TPI point (either implicitPoint3D_TPI or implicitPoint3D_IDX)
+template<typename TPI_point>
+void writeTPI(FILE *fp, const TPI_point &p, const std::map<std::tuple<double, double, double>, uint> &v_map)
+{
+    const explicitPoint3D &eu1 = p.U1();   std::tuple<double,double,double> tu1(eu1.X(), eu1.Y(), eu1.Z());
+    const explicitPoint3D &eu2 = p.U2();   std::tuple<double,double,double> tu2(eu2.X(), eu2.Y(), eu2.Z());
+    const explicitPoint3D &eu3 = p.U3();   std::tuple<double,double,double> tu3(eu3.X(), eu3.Y(), eu3.Z());
+    const explicitPoint3D &ev1 = p.V1();   std::tuple<double,double,double> tv1(ev1.X(), ev1.Y(), ev1.Z());
+    const explicitPoint3D &ev2 = p.V2();   std::tuple<double,double,double> tv2(ev2.X(), ev2.Y(), ev2.Z());
+    const explicitPoint3D &ev3 = p.V3();   std::tuple<double,double,double> tv3(ev3.X(), ev3.Y(), ev3.Z());
+    const explicitPoint3D &ew1 = p.W1();   std::tuple<double,double,double> tw1(ew1.X(), ew1.Y(), ew1.Z());
+    const explicitPoint3D &ew2 = p.W2();   std::tuple<double,double,double> tw2(ew2.X(), ew2.Y(), ew2.Z());
+    const explicitPoint3D &ew3 = p.W3();   std::tuple<double,double,double> tw3(ew3.X(), ew3.Y(), ew3.Z());
+
+    uint id_u1 = v_map.find(tu1)->second;   uint id_u2 = v_map.find(tu2)->second;   uint id_u3 = v_map.find(tu3)->second;
+    uint id_v1 = v_map.find(tv1)->second;   uint id_v2 = v_map.find(tv2)->second;   uint id_v3 = v_map.find(tv3)->second;
+    uint id_w1 = v_map.find(tw1)->second;   uint id_w2 = v_map.find(tw2)->second;   uint id_w3 = v_map.find(tw3)->second;
+
+    fprintf(fp, "t %d %d %d %d %d %d %d %d %d\n", id_u1, id_u2, id_u3, id_v1, id_v2, id_v3, id_w1, id_w2, id_w3);
+}
+
+//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
 void writeIMPL(const string &filename, const std::vector<genericPoint *> &verts, const std::vector<uint> &tris, const std::vector<std::bitset<NBIT> > &labels)
 {
     setlocale(LC_NUMERIC, "en_US.UTF-8"); // makes sure "." is the decimal separator
@@ -267,37 +332,10 @@ void writeIMPL(const string &filename, const std::vector<genericPoint *> &verts,
             const explicitPoint3D &ev = verts[v_id]->toExplicit3D();
             fprintf(fp, "e %.17g %.17g %.17g\n", ev.X(), ev.Y(), ev.Z());
         }
-        else if(verts[v_id]->isLPI())
-        {
-            const explicitPoint3D &ep = verts[v_id]->toLPI().P();   std::tuple<double,double,double> tp(ep.X(), ep.Y(), ep.Z());
-            const explicitPoint3D &eq = verts[v_id]->toLPI().Q();   std::tuple<double,double,double> tq(eq.X(), eq.Y(), eq.Z());
-            const explicitPoint3D &er = verts[v_id]->toLPI().R();   std::tuple<double,double,double> tr(er.X(), er.Y(), er.Z());
-            const explicitPoint3D &es = verts[v_id]->toLPI().S();   std::tuple<double,double,double> ts(es.X(), es.Y(), es.Z());
-            const explicitPoint3D &et = verts[v_id]->toLPI().T();   std::tuple<double,double,double> tt(et.X(), et.Y(), et.Z());
-
-            uint id_p = v_map.find(tp)->second;     uint id_q = v_map.find(tq)->second;
-            uint id_r = v_map.find(tr)->second;     uint id_s = v_map.find(ts)->second;     uint id_t = v_map.find(tt)->second;
-
-            fprintf(fp, "l %d %d %d %d %d\n", id_p, id_q, id_r, id_s, id_t);
-        }
-        else if(verts[v_id]->isTPI())
-        {
-            const explicitPoint3D &eu1 = verts[v_id]->toTPI().U1();   std::tuple<double,double,double> tu1(eu1.X(), eu1.Y(), eu1.Z());
-            const explicitPoint3D &eu2 = verts[v_id]->toTPI().U2();   std::tuple<double,double,double> tu2(eu2.X(), eu2.Y(), eu2.Z());
-            const explicitPoint3D &eu3 = verts[v_id]->toTPI().U3();   std::tuple<double,double,double> tu3(eu3.X(), eu3.Y(), eu3.Z());
-            const explicitPoint3D &ev1 = verts[v_id]->toTPI().V1();   std::tuple<double,double,double> tv1(ev1.X(), ev1.Y(), ev1.Z());
-            const explicitPoint3D &ev2 = verts[v_id]->toTPI().V2();   std::tuple<double,double,double> tv2(ev2.X(), ev2.Y(), ev2.Z());
-            const explicitPoint3D &ev3 = verts[v_id]->toTPI().V3();   std::tuple<double,double,double> tv3(ev3.X(), ev3.Y(), ev3.Z());
-            const explicitPoint3D &ew1 = verts[v_id]->toTPI().W1();   std::tuple<double,double,double> tw1(ew1.X(), ew1.Y(), ew1.Z());
-            const explicitPoint3D &ew2 = verts[v_id]->toTPI().W2();   std::tuple<double,double,double> tw2(ew2.X(), ew2.Y(), ew2.Z());
-            const explicitPoint3D &ew3 = verts[v_id]->toTPI().W3();   std::tuple<double,double,double> tw3(ew3.X(), ew3.Y(), ew3.Z());
-
-            uint id_u1 = v_map.find(tu1)->second;   uint id_u2 = v_map.find(tu2)->second;   uint id_u3 = v_map.find(tu3)->second;
-            uint id_v1 = v_map.find(tv1)->second;   uint id_v2 = v_map.find(tv2)->second;   uint id_v3 = v_map.find(tv3)->second;
-            uint id_w1 = v_map.find(tw1)->second;   uint id_w2 = v_map.find(tw2)->second;   uint id_w3 = v_map.find(tw3)->second;
-
-            fprintf(fp, "t %d %d %d %d %d %d %d %d %d\n", id_u1, id_u2, id_u3, id_v1, id_v2, id_v3, id_w1, id_w2, id_w3);
-        }
+        else if(verts[v_id]->isLPI())        writeLPI(fp, verts[v_id]->toLPI(), v_map);
+        else if(verts[v_id]->isIndexedLPI()) writeLPI(fp, verts[v_id]->toIndexed(), v_map);
+        else if(verts[v_id]->isTPI())        writeTPI(fp, verts[v_id]->toTPI(), v_map);
+        else if(verts[v_id]->isIndexedTPI()) writeTPI(fp, verts[v_id]->toIndexed(), v_map);
     }
 
     for(uint t_id = 0; t_id < tris.size()/3; t_id++)
@@ -55,11 +55,14 @@
 #include <common.h>
 
 
+// throws std::runtime_error if the file cannot be opened or its format is not supported
 void load(const std::string &filename, std::vector<double> &coords, std::vector<uint> &tris);
 
-void loadMultipleFiles(const std::vector<std::string> &files, std::vector<double> &coords, std::vector<uint> &tris, std::vector<uint> &labels);
+// the files are parsed concurrently if parallel is set, then copied to their place in the (pre-sized) output.
+// Errors of load() are thrown to the caller
+void loadMultipleFiles(const std::vector<std::string> &files, std::vector<double> &coords, std::vector<uint> &tris, std::vector<uint> &labels, bool parallel = true);
 
-void loadMultipleFiles(const std::vector<std::string> &files, std::vector<double> &coords, std::vector<uint> &tris, std::vector<uint> &labels, int &vert_offset);
+void loadMultipleFiles(const std::vector<std::string> &files, std::vector<double> &coords, std::vector<uint> &tris, std::vector<uint> &labels, int &vert_offset, bool parallel = true);
 
 void loadMultipleFilesWithVertFix(const std::vector<std::string> &files, std::vector<double> &coords, std::vector<uint> &tris, std::vector<uint> &labels);
 
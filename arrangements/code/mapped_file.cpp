@@ -0,0 +1,133 @@
+/*****************************************************************************************
+ *              MIT License                                                              *
+ *                                                                                       *
+ * Copyright (c) 2020 Gianmarco Cherchi, Marco Livesu, Riccardo Scateni e Marco Attene   *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION     *
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        *
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                *
+ *                                                                                       *
+ * Authors:                                                                              *
+ *      Gianmarco Cherchi (g.cherchi@unica.it)                                           *
+ *      https://people.unica.it/gianmarcocherchi/                                        *
+ *                                                                                       *
+ *      Marco Livesu (marco.livesu@ge.imati.cnr.it)                                      *
+ *      http://pers.ge.imati.cnr.it/livesu/                                              *
+ *                                                                                       *
+ *      Riccardo Scateni (riccardo@unica.it)                                             *
+ *      https://people.unica.it/riccardoscateni/                                         *
+ *                                                                                       *
+ *      Marco Attene (marco.attene@ge.imati.cnr.it)                                      *
+ *      https://www.cnr.it/en/people/marco.attene/                                       *
+ *                                                                                       *
+ * ***************************************************************************************/
+
+#include "mapped_file.h"
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+bool MappedFile::open(const std::string &filename)
+{
+    close();
+
+#ifdef _WIN32
+    HANDLE f = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                           FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if(f == INVALID_HANDLE_VALUE) return false;
+
+    LARGE_INTEGER file_size;
+    if(!GetFileSizeEx(f, &file_size))
+    {
+        CloseHandle(f);
+        return false;
+    }
+
+    file = f;
+    len  = static_cast<size_t>(file_size.QuadPart);
+
+    if(len > 0)
+    {
+        HANDLE m = CreateFileMappingA(f, NULL, PAGE_READONLY, 0, 0, NULL);
+        if(m == NULL)
+        {
+            close();
+            return false;
+        }
+        mapping = m;
+
+        ptr = static_cast<const char*>(MapViewOfFile(m, FILE_MAP_READ, 0, 0, 0));
+        if(ptr == nullptr)
+        {
+            close();
+            return false;
+        }
+    }
+#else
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if(fd < 0) return false;
+
+    struct stat st;
+    if(fstat(fd, &st) != 0)
+    {
+        ::close(fd);
+        return false;
+    }
+
+    len = static_cast<size_t>(st.st_size);
+
+    if(len > 0)
+    {
+        void *p = mmap(nullptr, len, PROT_READ, MAP_PRIVATE, fd, 0);
+        if(p == MAP_FAILED)
+        {
+            ::close(fd);
+            len = 0;
+            return false;
+        }
+        madvise(p, len, MADV_SEQUENTIAL);
+        ptr = static_cast<const char*>(p);
+    }
+
+    ::close(fd); // the mapping stays valid
+#endif
+
+    is_open = true;
+    return true;
+}
+
+void MappedFile::close()
+{
+#ifdef _WIN32
+    if(ptr)     UnmapViewOfFile(ptr);
+    if(mapping) CloseHandle(static_cast<HANDLE>(mapping));
+    if(file)    CloseHandle(static_cast<HANDLE>(file));
+    mapping = file = nullptr;
+#else
+    if(ptr) munmap(const_cast<char*>(ptr), len);
+#endif
+
+    ptr     = nullptr;
+    len     = 0;
+    is_open = false;
+}
@@ -0,0 +1,295 @@
+/*****************************************************************************************
+ *              MIT License                                                              *
+ *                                                                                       *
+ * Copyright (c) 2020 Gianmarco Cherchi, Marco Livesu, Riccardo Scateni e Marco Attene   *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION     *
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        *
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                *
+ *                                                                                       *
+ * Authors:                                                                              *
+ *      Gianmarco Cherchi (g.cherchi@unica.it)                                           *
+ *      https://people.unica.it/gianmarcocherchi/                                        *
+ *                                                                                       *
+ *      Marco Livesu (marco.livesu@ge.imati.cnr.it)                                      *
+ *      http://pers.ge.imati.cnr.it/livesu/                                              *
+ *                                                                                       *
+ *      Riccardo Scateni (riccardo@unica.it)                                             *
+ *      https://people.unica.it/riccardoscateni/                                         *
+ *                                                                                       *
+ *      Marco Attene (marco.attene@ge.imati.cnr.it)                                      *
+ *      https://www.cnr.it/en/people/marco.attene/                                       *
+ *                                                                                       *
+ * ***************************************************************************************/
+#include "mesh_sink.h"
+
+#include <tbb/tbb.h>
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+namespace
+{
+
+const uint LINES_PER_BLOCK = 4096;
+
+template<typename F>
+void forEach(uint n, bool parallel, const F &f)
+{
+    if(parallel) tbb::parallel_for(static_cast<uint>(0), n, f);
+    else for(uint i = 0; i < n; i++) f(i);
+}
+
+// text of n lines, formatted by blocks of LINES_PER_BLOCK lines (in parallel) and joined in order
+template<typename F>
+std::string formatLines(uint n, bool parallel, const F &format_line)
+{
+    uint num_blocks = (n + LINES_PER_BLOCK - 1) / LINES_PER_BLOCK;
+    std::vector<std::string> blocks(num_blocks);
+
+    forEach(num_blocks, parallel, [&](uint b)
+    {
+        char line[128];
+        uint stop = std::min(n, (b + 1) * LINES_PER_BLOCK);
+        for(uint i = b * LINES_PER_BLOCK; i < stop; i++)
+        {
+            int len = format_line(line, sizeof(line), i);
+            blocks[b].append(line, static_cast<size_t>(len));
+        }
+    });
+
+    size_t size = 0;
+    for(const std::string &block : blocks) size += block.size();
+
+    std::string text;
+    text.reserve(size);
+    for(const std::string &block : blocks) text += block;
+    return text;
+}
+
+// "%.17g" and "%d" of printf in the "C" locale, without reading (or requiring a change of) the global locale
+inline char *writeDouble(char *first, char *last, double d)
+{
+    return std::to_chars(first, last, d, std::chars_format::general, 17).ptr;
+}
+
+inline char *writeUint(char *first, char *last, uint i)
+{
+    return std::to_chars(first, last, i).ptr;
+}
+
+inline bool hostIsLittleEndian()
+{
+    const uint32_t one = 1;
+    uint8_t first;
+    memcpy(&first, &one, 1);
+    return first == 1;
+}
+
+} // namespace
+
+//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+void VectorSink::begin(uint num_verts, uint num_tris)
+{
+    coords.clear();
+    tris.clear();
+    labels.clear();
+    coords.reserve(3 * static_cast<size_t>(num_verts));
+    tris.reserve(3 * static_cast<size_t>(num_tris));
+    labels.reserve(num_tris);
+}
+
+void VectorSink::vertices(const double *v_coords, uint num_verts)
+{
+    coords.insert(coords.end(), v_coords, v_coords + 3 * static_cast<size_t>(num_verts));
+}
+
+void VectorSink::triangles(const uint *t_ids, const std::bitset<NBIT> *t_labels, uint num_tris)
+{
+    tris.insert(tris.end(), t_ids, t_ids + 3 * static_cast<size_t>(num_tris));
+    labels.insert(labels.end(), t_labels, t_labels + num_tris);
+}
+
+//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+FileSink::~FileSink()
+{
+    if(fp) fclose(fp);
+}
+
+void FileSink::open(const char *mode)
+{
+    fp = fopen(filename.c_str(), mode);
+    if(!fp) throw std::runtime_error("FileSink : couldn't open output file " + filename);
+}
+
+void FileSink::write(const void *data, size_t bytes)
+{
+    if(bytes > 0 && fwrite(data, 1, bytes, fp) != bytes) throw std::runtime_error("FileSink : couldn't write " + filename);
+}
+
+void FileSink::end()
+{
+    FILE *f = fp;
+    fp = nullptr;
+    if(f && fclose(f) != 0) throw std::runtime_error("FileSink : couldn't write " + filename);
+}
+
+//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+void OBJSink::begin(uint /*num_verts*/, uint /*num_tris*/)
+{
+    open("w");
+}
+
+void OBJSink::vertices(const double *coords, uint num_verts)
+{
+    std::string text = formatLines(num_verts, parallel, [coords](char *line, size_t size, uint v_id)
+    {
+        const double *v = coords + 3 * static_cast<size_t>(v_id);
+        char *c = line, *last = line + size;
+        *c++ = 'v';
+        for(uint i = 0; i < 3; i++)
+        {
+            *c++ = ' ';
+            c = writeDouble(c, last, v[i]);
+        }
+        *c++ = '\n';
+        return static_cast<int>(c - line);
+    });
+    write(text.data(), text.size());
+}
+
+void OBJSink::triangles(const uint *tris, const std::bitset<NBIT> */*labels*/, uint num_tris)
+{
+    std::string text = formatLines(num_tris, parallel, [tris](char *line, size_t size, uint t_id)
+    {
+        const uint *t = tris + 3 * static_cast<size_t>(t_id);
+        char *c = line, *last = line + size;
+        *c++ = 'f';
+        for(uint i = 0; i < 3; i++)
+        {
+            *c++ = ' ';
+            c = writeUint(c, last, t[i] + 1);
+        }
+        *c++ = '\n';
+        return static_cast<int>(c - line);
+    });
+    write(text.data(), text.size());
+}
+
+//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+void PLYSink::begin(uint num_verts, uint num_tris)
+{
+    open("wb");
+
+    std::string header = std::string("ply\nformat ") + (hostIsLittleEndian() ? "binary_little_endian" : "binary_big_endian") + " 1.0\n" +
+                         "element vertex " + std::to_string(num_verts) + "\n" +
+                         "property double x\nproperty double y\nproperty double z\n" +
+                         "element face " + std::to_string(num_tris) + "\n" +
+                         "property list uchar int vertex_indices\nend_header\n";
+    write(header.data(), header.size());
+}
+
+void PLYSink::vertices(const double *coords, uint num_verts)
+{
+    write(coords, 3 * static_cast<size_t>(num_verts) * sizeof(double));
+}
+
+void PLYSink::triangles(const uint *tris, const std::bitset<NBIT> */*labels*/, uint num_tris)
+{
+    const size_t face_size = 1 + 3 * sizeof(int32_t);
+    std::vector<char> buffer(num_tris * face_size);
+
+    forEach(num_tris, parallel, [&](uint t_id)
+    {
+        char *face = buffer.data() + t_id * face_size;
+        face[0] = 3;
+        memcpy(face + 1, tris + 3 * static_cast<size_t>(t_id), 3 * sizeof(int32_t));
+    });
+    write(buffer.data(), buffer.size());
+}
+
+//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+void STLSink::begin(uint num_verts, uint num_tris)
+{
+    open("wb");
+
+    char header[80] = "binary STL";
+    uint32_t n = num_tris;
+    write(header, sizeof(header));
+    write(&n, sizeof(n));
+
+    verts.clear();
+    verts.reserve(3 * static_cast<size_t>(num_verts));
+}
+
+void STLSink::vertices(const double *coords, uint num_verts)
+{
+    size_t off = verts.size();
+    verts.resize(off + 3 * static_cast<size_t>(num_verts));
+    for(size_t i = 0; i < 3 * static_cast<size_t>(num_verts); i++) verts[off + i] = static_cast<float>(coords[i]);
+}
+
+void STLSink::triangles(const uint *tris, const std::bitset<NBIT> */*labels*/, uint num_tris)
+{
+    const size_t record_size = 50; // normal, 3 vertices, attribute byte count
+    std::vector<char> buffer(num_tris * record_size, 0);
+
+    forEach(num_tris, parallel, [&](uint t_id)
+    {
+        const uint *t = tris + 3 * static_cast<size_t>(t_id);
+        const float *p[3] = {&verts[3 * static_cast<size_t>(t[0])], &verts[3 * static_cast<size_t>(t[1])], &verts[3 * static_cast<size_t>(t[2])]};
+
+        double u[3], v[3];
+        for(uint i = 0; i < 3; i++)
+        {
+            u[i] = static_cast<double>(p[1][i]) - p[0][i];
+            v[i] = static_cast<double>(p[2][i]) - p[0][i];
+        }
+        double n[3] = {u[1] * v[2] - u[2] * v[1], u[2] * v[0] - u[0] * v[2], u[0] * v[1] - u[1] * v[0]};
+        double len = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+        float normal[3] = {0.f, 0.f, 0.f};
+        if(len > 0) for(uint i = 0; i < 3; i++) normal[i] = static_cast<float>(n[i] / len);
+
+        char *record = buffer.data() + t_id * record_size;
+        memcpy(record, normal, sizeof(normal));
+        for(uint i = 0; i < 3; i++) memcpy(record + 12 * (i + 1), p[i], 3 * sizeof(float));
+    });
+    write(buffer.data(), buffer.size());
+}
+
+//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+std::unique_ptr<MeshSink> makeFileSink(const std::string &filename, bool parallel)
+{
+    std::string ext = (filename.size() >= 4) ? filename.substr(filename.size() - 4) : std::string();
+    std::transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+
+    if(ext == ".obj") return std::make_unique<OBJSink>(filename, parallel);
+    if(ext == ".ply") return std::make_unique<PLYSink>(filename, parallel);
+    if(ext == ".stl") return std::make_unique<STLSink>(filename, parallel);
+
+    throw std::runtime_error("makeFileSink() : file format not supported yet " + filename);
+}
@@ -0,0 +1,158 @@
+/*****************************************************************************************
+ *              MIT License                                                              *
+ *                                                                                       *
+ * Copyright (c) 2020 Gianmarco Cherchi, Marco Livesu, Riccardo Scateni e Marco Attene   *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION     *
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        *
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                *
+ *                                                                                       *
+ * Authors:                                                                              *
+ *      Gianmarco Cherchi (g.cherchi@unica.it)                                           *
+ *      https://people.unica.it/gianmarcocherchi/                                        *
+ *                                                                                       *
+ *      Marco Livesu (marco.livesu@ge.imati.cnr.it)                                      *
+ *      http://pers.ge.imati.cnr.it/livesu/                                              *
+ *                                                                                       *
+ *      Riccardo Scateni (riccardo@unica.it)                                             *
+ *      https://people.unica.it/riccardoscateni/                                         *
+ *                                                                                       *
+ *      Marco Attene (marco.attene@ge.imati.cnr.it)                                      *
+ *      https://www.cnr.it/en/people/marco.attene/                                       *
+ *                                                                                       *
+ * ***************************************************************************************/
+
+
+#ifndef MESH_SINK_H
+#define MESH_SINK_H
+
+#include "common.h"
+
+#include <bitset>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+typedef unsigned int uint;
+
+// Receiver of a triangle mesh produced in chunks (see streamFinalExplicitResult), so that the whole
+// mesh never has to be stored. The calls come from a single thread, in this order: begin, with the
+// final sizes, then vertices until all of them are passed, then triangles, then end
+class MeshSink
+{
+    public:
+
+        virtual ~MeshSink() {}
+
+        virtual void begin(uint num_verts, uint num_tris) = 0;
+
+        // 3 coordinates per vertex
+        virtual void vertices(const double *coords, uint num_verts) = 0;
+
+        // 3 vertex ids per triangle, and the label of each triangle
+        virtual void triangles(const uint *tris, const std::bitset<NBIT> *labels, uint num_tris) = 0;
+
+        virtual void end() = 0;
+};
+
+// collects the mesh in the vectors, as computeFinalExplicitResult fills them
+class VectorSink : public MeshSink
+{
+    public:
+
+        VectorSink(std::vector<double> &coords, std::vector<uint> &tris, std::vector<std::bitset<NBIT>> &labels)
+            : coords(coords), tris(tris), labels(labels) {}
+
+        void begin(uint num_verts, uint num_tris) override;
+        void vertices(const double *coords, uint num_verts) override;
+        void triangles(const uint *tris, const std::bitset<NBIT> *labels, uint num_tris) override;
+        void end() override {}
+
+    private:
+
+        std::vector<double>            &coords;
+        std::vector<uint>              &tris;
+        std::vector<std::bitset<NBIT>> &labels;
+};
+
+// Writers to file. The file is created by begin (nothing is written if the mesh never comes, e.g. when
+// the pipeline is cancelled) and closed by end. Chunks are encoded in parallel (if parallel is set)
+// and written with a single call. I/O errors throw std::runtime_error
+class FileSink : public MeshSink
+{
+    public:
+
+        FileSink(const std::string &filename, bool parallel) : filename(filename), parallel(parallel) {}
+        ~FileSink() override;
+
+        void end() override;
+
+    protected:
+
+        void open(const char *mode);
+        void write(const void *data, size_t bytes);
+
+        std::string filename;
+        bool        parallel;
+        FILE       *fp = nullptr;
+};
+
+// same text of cinolib::write_OBJ, formatted without changing (or depending on) the global locale
+class OBJSink : public FileSink
+{
+    public:
+
+        OBJSink(const std::string &filename, bool parallel = true) : FileSink(filename, parallel) {}
+
+        void begin(uint num_verts, uint num_tris) override;
+        void vertices(const double *coords, uint num_verts) override;
+        void triangles(const uint *tris, const std::bitset<NBIT> *labels, uint num_tris) override;
+};
+
+// binary PLY, in the endianness of the machine: double x,y,z and faces as a uchar/int list named vertex_indices
+class PLYSink : public FileSink
+{
+    public:
+
+        PLYSink(const std::string &filename, bool parallel = true) : FileSink(filename, parallel) {}
+
+        void begin(uint num_verts, uint num_tris) override;
+        void vertices(const double *coords, uint num_verts) override;
+        void triangles(const uint *tris, const std::bitset<NBIT> *labels, uint num_tris) override;
+};
+
+// binary STL. Triangles are stored with their coordinates, so the vertices (as floats) are kept until
+// the triangles come
+class STLSink : public FileSink
+{
+    public:
+
+        STLSink(const std::string &filename, bool parallel = true) : FileSink(filename, parallel) {}
+
+        void begin(uint num_verts, uint num_tris) override;
+        void vertices(const double *coords, uint num_verts) override;
+        void triangles(const uint *tris, const std::bitset<NBIT> *labels, uint num_tris) override;
+
+    private:
+
+        std::vector<float> verts;
+};
+
+// writer for the extension of filename (.obj, .ply or .stl, in any case). Throws std::runtime_error on other extensions
+std::unique_ptr<MeshSink> makeFileSink(const std::string &filename, bool parallel = true);
+
+#endif // MESH_SINK_H
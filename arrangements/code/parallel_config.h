@@ -0,0 +1,89 @@
+/*****************************************************************************************
+ *              MIT License                                                              *
+ *                                                                                       *
+ * Copyright (c) 2020 Gianmarco Cherchi, Marco Livesu, Riccardo Scateni e Marco Attene   *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION     *
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        *
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                *
+ *                                                                                       *
+ * Authors:                                                                              *
+ *      Gianmarco Cherchi (g.cherchi@unica.it)                                           *
+ *      https://people.unica.it/gianmarcocherchi/                                        *
+ *                                                                                       *
+ *      Marco Livesu (marco.livesu@ge.imati.cnr.it)                                      *
+ *      http://pers.ge.imati.cnr.it/livesu/                                              *
+ *                                                                                       *
+ *      Riccardo Scateni (riccardo@unica.it)                                             *
+ *      https://people.unica.it/riccardoscateni/                                         *
+ *                                                                                       *
+ *      Marco Attene (marco.attene@ge.imati.cnr.it)                                      *
+ *      https://www.cnr.it/en/people/marco.attene/                                       *
+ *                                                                                       *
+ * ***************************************************************************************/
+
+#ifndef PARALLEL_CONFIG_H
+#define PARALLEL_CONFIG_H
+
+#include <tbb/task_arena.h>
+#include "common.h"
+
+// Controls where and how wide the pipeline runs in parallel, for embedding it next to other
+// TBB users. The whole pipeline runs inside one task arena, isolated so that the threads waiting
+// in it never pick up unrelated work (and the other way round):
+// - arena set:            the caller provided arena (its concurrency is decided by the caller)
+// - max_concurrency > 0:  an arena owned by the run, with at most max_concurrency threads
+// - otherwise:            the arena of the calling thread (the global one, by default)
+// serial overrides all of the above: the pipeline runs on the calling thread only, and the
+// phases that have a serial implementation use it. schedule is the order in which the triangulation
+// hands the intersected triangles to the workers.
+struct ParallelConfig
+{
+    int                    max_concurrency = -1;
+    tbb::task_arena       *arena           = nullptr;
+    bool                   serial          = false;
+    TriangulationSchedule  schedule        = INPUT_ORDER;
+
+    static ParallelConfig threads(int n)  { ParallelConfig c; c.max_concurrency = n; return c; }
+    static ParallelConfig serialRun()     { ParallelConfig c; c.serial = true; return c; }
+
+    // true if the phases should use their parallel implementation
+    bool parallel() const { return !serial; }
+
+    template<typename F>
+    void execute(F &&f) const
+    {
+        auto isolated = [&]() { tbb::this_task_arena::isolate(f); };
+
+        if(serial)
+        {
+            tbb::task_arena single(1);
+            single.execute(isolated);
+        }
+        else if(arena)
+        {
+            arena->execute(isolated);
+        }
+        else if(max_concurrency > 0)
+        {
+            tbb::task_arena owned(max_concurrency);
+            owned.execute(isolated);
+        }
+        else isolated();
+    }
+};
+
+#endif // PARALLEL_CONFIG_H
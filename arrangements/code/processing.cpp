@@ -182,57 +182,71 @@ void freePointsMemory(std::vector<genericPoint *> &points)
 
 //:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
-void computeApproximateCoordinates(const std::vector<genericPoint *> &vertices, std::vector<double> &coords)
+// approximated coordinates of vertices [begin, end), rescaled, to xyz (3 doubles per vertex)
+static void approximateCoordinatesRange(const std::vector<genericPoint *> &vertices, uint begin, uint end, double multiplier, double *xyz)
 {
-    coords.reserve(3 * (vertices.size() -5));
-    double multiplier = vertices.back()->toExplicit3D().X();
-
-    for(uint i = 0; i < (vertices.size() - 5); i++)
+    for(uint i = begin; i < end; i++)
     {
         auto &v = vertices[i];
+        double *c = xyz + 3 * static_cast<size_t>(i - begin);
 
         if(v->isExplicit3D())
         {
-            coords.push_back(v->toExplicit3D().X() / multiplier);
-            coords.push_back(v->toExplicit3D().Y() / multiplier);
-            coords.push_back(v->toExplicit3D().Z() / multiplier);
-        }
-        else //implicit point
-        {
-            double x, y, z;
-            v->getApproxXYZCoordinates(x, y, z);
-            coords.push_back(x / multiplier);
-            coords.push_back(y / multiplier);
-            coords.push_back(z / multiplier);
+            c[0] = v->toExplicit3D().X();
+            c[1] = v->toExplicit3D().Y();
+            c[2] = v->toExplicit3D().Z();
         }
+        else v->getApproxXYZCoordinates(c[0], c[1], c[2]); //implicit point
     }
+
+    for(size_t i = 0; i < 3 * static_cast<size_t>(end - begin); i++) xyz[i] /= multiplier;
 }
+
 //:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
-void computeApproximateCoordinates(const std::vector<genericPoint *> &vertices, std::vector<cinolib::vec3d> &out_vertices)
+void computeApproximateCoordinates(const std::vector<genericPoint *> &vertices, std::vector<double> &coords, bool parallel)
 {
-    out_vertices.reserve((vertices.size() -5));
+    uint num_verts = static_cast<uint>(vertices.size() - 5);
     double multiplier = vertices.back()->toExplicit3D().X();
 
-    for(uint i = 0; i < (vertices.size() - 5); i++)
-    {
-        auto &v = vertices[i];
+    size_t off = coords.size();
+    coords.resize(off + 3 * static_cast<size_t>(num_verts));
+    double *xyz = coords.data() + off;
 
-        if(v->isExplicit3D())
+    if(parallel)
+        tbb::parallel_for(tbb::blocked_range<uint>(0, num_verts), [&](const tbb::blocked_range<uint> &r)
         {
-            out_vertices.emplace_back(v->toExplicit3D().X() / multiplier,
-                                      v->toExplicit3D().Y() / multiplier,
-                                      v->toExplicit3D().Z() / multiplier);
-        }
-        else //implicit point
+            approximateCoordinatesRange(vertices, r.begin(), r.end(), multiplier, xyz + 3 * static_cast<size_t>(r.begin()));
+        });
+    else
+        approximateCoordinatesRange(vertices, 0, num_verts, multiplier, xyz);
+}
+//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+void computeApproximateCoordinates(const std::vector<genericPoint *> &vertices, std::vector<cinolib::vec3d> &out_vertices, bool parallel)
+{
+    uint num_verts = static_cast<uint>(vertices.size() - 5);
+    double multiplier = vertices.back()->toExplicit3D().X();
+
+    size_t off = out_vertices.size();
+    out_vertices.resize(off + num_verts);
+
+    auto convert = [&](uint begin, uint end)
+    {
+        double c[3 * 256];
+        for(uint first = begin; first < end; first += 256)
         {
-            double x, y, z;
-            v->getApproxXYZCoordinates(x, y, z);
-            out_vertices.emplace_back(x / multiplier,
-                                      y / multiplier,
-                                      z / multiplier);
+            uint last = std::min(end, first + 256);
+            approximateCoordinatesRange(vertices, first, last, multiplier, c);
+            for(uint i = first; i < last; i++)
+                out_vertices[off + i] = cinolib::vec3d(c[3 * (i - first)], c[3 * (i - first) + 1], c[3 * (i - first) + 2]);
         }
-    }
+    };
+
+    if(parallel)
+        tbb::parallel_for(tbb::blocked_range<uint>(0, num_verts), [&](const tbb::blocked_range<uint> &r) { convert(r.begin(), r.end()); });
+    else
+        convert(0, num_verts);
 }
 
 
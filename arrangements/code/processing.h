@@ -58,9 +58,10 @@ void removeDegenerateAndDuplicatedTriangles(const std::vector<genericPoint *> &v
 
 void freePointsMemory(std::vector<genericPoint*> &points);
 
-void computeApproximateCoordinates(const std::vector<genericPoint *> &vertices, std::vector<double> &coords);
+// the coordinates (jolly points excluded) are appended to coords/out_vertices, computed by blocks in parallel if parallel is set
+void computeApproximateCoordinates(const std::vector<genericPoint *> &vertices, std::vector<double> &coords, bool parallel = true);
 
-void computeApproximateCoordinates(const std::vector<genericPoint *> &vertices, std::vector<cinolib::vec3d> &out_vertices);
+void computeApproximateCoordinates(const std::vector<genericPoint *> &vertices, std::vector<cinolib::vec3d> &out_vertices, bool parallel = true);
 
 //#include "processing.cpp"
 
@@ -38,7 +38,8 @@
 #include "solve_intersections.h"
 
 void meshArrangementPipeline(const std::vector<double> &in_coords, const std::vector<uint> &in_tris, const std::vector< std::bitset<NBIT> > &in_labels, point_arena &arena,
-                                    std::vector<genericPoint*> &vertices, std::vector<uint> &out_tris, std::vector< std::bitset<NBIT> > &out_labels)
+                                    std::vector<genericPoint*> &vertices, std::vector<uint> &out_tris, std::vector< std::bitset<NBIT> > &out_labels,
+                                    bool parallel)
 {
     initFPU();
 
@@ -49,11 +50,11 @@ void meshArrangementPipeline(const std::vector<double> &in_coords, const std::ve
     std::vector<uint> tmp_tris;
     std::vector< std::bitset<NBIT> > tmp_labels;
 
-    mergeDuplicatedVertices(in_coords, in_tris, arena, vertices, tmp_tris, true);
+    mergeDuplicatedVertices(in_coords, in_tris, arena, vertices, tmp_tris, parallel);
 
     removeDegenerateAndDuplicatedTriangles(vertices, in_labels, tmp_tris, tmp_labels);
 
-    TriangleSoup ts(arena, vertices, tmp_tris, tmp_labels, multiplier, true);
+    TriangleSoup ts(arena, vertices, tmp_tris, tmp_labels, multiplier, parallel);
 
     detectIntersections(ts, g.intersectionList());
 
@@ -61,7 +62,7 @@ void meshArrangementPipeline(const std::vector<double> &in_coords, const std::ve
 
     classifyIntersections(ts, arena, g);
 
-    triangulation(ts, arena, g, out_tris, out_labels);
+    triangulation(ts, arena, g, out_tris, out_labels, SPLIT_AND_WALK, nullptr, INPUT_ORDER, parallel);
 
     ts.appendJollyPoints();
 }
@@ -69,31 +70,40 @@ void meshArrangementPipeline(const std::vector<double> &in_coords, const std::ve
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
 void solveIntersections(const std::vector<double> &in_coords, const std::vector<uint> &in_tris, point_arena &arena,
-                               std::vector<double> &out_coords, std::vector<uint> &out_tris)
+                               std::vector<double> &out_coords, std::vector<uint> &out_tris,
+                               const ParallelConfig &parallel)
 {
     std::vector<genericPoint*> vertices;
     std::vector< std::bitset<NBIT>> tmp_in_labels(in_tris.size() / 3), out_labels;
 
-    meshArrangementPipeline(in_coords, in_tris, tmp_in_labels, arena, vertices, out_tris, out_labels);
+    parallel.execute([&]()
+    {
+        meshArrangementPipeline(in_coords, in_tris, tmp_in_labels, arena, vertices, out_tris, out_labels, parallel.parallel());
 
-    computeApproximateCoordinates(vertices, out_coords);
+        computeApproximateCoordinates(vertices, out_coords);
+    });
     freePointsMemory(vertices);
 }
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
 void solveIntersections(const std::vector<double> &in_coords, const std::vector<uint> &in_tris, point_arena &arena,
-                               std::vector<genericPoint *> &out_vertices, std::vector<uint> &out_tris)
+                               std::vector<genericPoint *> &out_vertices, std::vector<uint> &out_tris,
+                               const ParallelConfig &parallel)
 {
     std::vector< std::bitset<NBIT>> tmp_in_labels(in_tris.size() / 3), out_labels;
 
-    meshArrangementPipeline(in_coords, in_tris, tmp_in_labels, arena, out_vertices, out_tris, out_labels);
+    parallel.execute([&]()
+    {
+        meshArrangementPipeline(in_coords, in_tris, tmp_in_labels, arena, out_vertices, out_tris, out_labels, parallel.parallel());
+    });
 }
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
 void solveIntersections(const std::vector<double> &in_coords, const std::vector<uint> &in_tris, const std::vector<uint> &in_labels, point_arena &arena,
-                                  std::vector<double> &out_coords, std::vector<uint> &out_tris, std::vector< std::bitset<NBIT> > &out_labels)
+                                  std::vector<double> &out_coords, std::vector<uint> &out_tris, std::vector< std::bitset<NBIT> > &out_labels,
+                                  const ParallelConfig &parallel)
 {
     std::vector<genericPoint*> vertices;
     std::vector< std::bitset<NBIT>> tmp_in_labels(in_labels.size());
@@ -101,21 +111,28 @@ void solveIntersections(const std::vector<double> &in_coords, const std::vector<
     for(uint i = 0; i < in_labels.size(); i++)
         tmp_in_labels[i][in_labels[i]] = 1;
 
-    meshArrangementPipeline(in_coords, in_tris, tmp_in_labels, arena, vertices, out_tris, out_labels);
+    parallel.execute([&]()
+    {
+        meshArrangementPipeline(in_coords, in_tris, tmp_in_labels, arena, vertices, out_tris, out_labels, parallel.parallel());
 
-    computeApproximateCoordinates(vertices, out_coords);
+        computeApproximateCoordinates(vertices, out_coords);
+    });
     freePointsMemory(vertices);
 }
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
 void solveIntersections(const std::vector<double> &in_coords, const std::vector<uint> &in_tris, const std::vector<uint> &in_labels, point_arena &arena,
-                               std::vector<genericPoint *> &vertices, std::vector<uint> &out_tris, std::vector<std::bitset<NBIT> > &out_labels)
+                               std::vector<genericPoint *> &vertices, std::vector<uint> &out_tris, std::vector<std::bitset<NBIT> > &out_labels,
+                               const ParallelConfig &parallel)
 {
     std::vector< std::bitset<NBIT>> tmp_in_labels(in_labels.size());
 
     for(uint i = 0; i < in_labels.size(); i++)
         tmp_in_labels[i][in_labels[i]] = 1;
 
-    meshArrangementPipeline(in_coords, in_tris, tmp_in_labels, arena, vertices, out_tris, out_labels);
+    parallel.execute([&]()
+    {
+        meshArrangementPipeline(in_coords, in_tris, tmp_in_labels, arena, vertices, out_tris, out_labels, parallel.parallel());
+    });
 }
@@ -43,6 +43,7 @@
 #include "triangle_soup.h"
 #include "intersection_classification.h"
 #include "triangulation.h"
+#include "parallel_config.h"
 
 #include <bitset>
 
@@ -51,7 +52,8 @@
 * Use one of the solveInterctions functions to interface whit it.
 */
 void meshArrangementPipeline(const std::vector<double> &in_coords, const std::vector<uint> &in_tris, const std::vector< std::bitset<NBIT> > &in_labels, point_arena &arena,
-                                    std::vector<genericPoint*> &out_vertices, std::vector<uint> &out_tris, std::vector< std::bitset<NBIT> > &out_labels);
+                                    std::vector<genericPoint*> &out_vertices, std::vector<uint> &out_tris, std::vector< std::bitset<NBIT> > &out_labels,
+                                    bool parallel = true);
 
 
 /**
@@ -63,9 +65,11 @@ void meshArrangementPipeline(const std::vector<double> &in_coords, const std::ve
  * @param arena: a temporary structure of type "point_arena" to efficiently manage the memory
  * @param out_coords: the coordinates of the points after the arrangement (the coordinates of the intersection points are approximate)
  * @param out_tris: the indices of the vertices of the output triangles
+ * @param parallel: where and how wide the arrangement runs in parallel (see parallel_config.h)
  */
 void solveIntersections(const std::vector<double> &in_coords, const std::vector<uint> &in_tris, point_arena &arena,
-                               std::vector<double> &out_coords, std::vector<uint> &out_tris);
+                               std::vector<double> &out_coords, std::vector<uint> &out_tris,
+                               const ParallelConfig &parallel = ParallelConfig());
 
 
 /**
@@ -77,13 +81,15 @@ void solveIntersections(const std::vector<double> &in_coords, const std::vector<
  * @param arena: a temporary structure of type "point_arena" to efficiently manage the memory
  * @param out_vertices: the set of vertices after the arrangement in implicit form (type: genericPoint*)
  * @param out_tris: the indices of the vertices of the output triangles
+ * @param parallel: where and how wide the arrangement runs in parallel (see parallel_config.h)
  *
  * IMPORTANT: if you use this function
  * - if, at some point, you need an approximation of your vertices you need to call the computeApproximateCoordinates(...) function contained in processing.h
  * - remember to free the dynamic allocated memory of the implicit points by calling the freePointsMemory(...) function contained in processing.h
  */
 void solveIntersections(const std::vector<double> &in_coords, const std::vector<uint> &in_tris, point_arena &arena,
-                               std::vector<genericPoint*> &out_vertices, std::vector<uint> &out_tris);
+                               std::vector<genericPoint*> &out_vertices, std::vector<uint> &out_tris,
+                               const ParallelConfig &parallel = ParallelConfig());
 
 
 
@@ -98,9 +104,11 @@ void solveIntersections(const std::vector<double> &in_coords, const std::vector<
  * @param out_coords: the coordinates of the points after the arrangement (the coordinates of the intersection points are approximate)
  * @param out_tris: the indices of the vertices of the output triangles
  * @param out_labels: a vector of bitset containing, for each output triangle, the set of labels of the generating input triangles
+ * @param parallel: where and how wide the arrangement runs in parallel (see parallel_config.h)
  */
 void solveIntersections(const std::vector<double> &in_coords, const std::vector<uint> &in_tris, const std::vector<uint> &in_labels, point_arena &arena,
-                               std::vector<double> &out_coords, std::vector<uint> &out_tris, std::vector< std::bitset<NBIT> > &out_labels);
+                               std::vector<double> &out_coords, std::vector<uint> &out_tris, std::vector< std::bitset<NBIT> > &out_labels,
+                               const ParallelConfig &parallel = ParallelConfig());
 
 
 /**
@@ -114,13 +122,15 @@ void solveIntersections(const std::vector<double> &in_coords, const std::vector<
  * @param out_vertices: the set of vertices after the arrangement in implicit form (type: genericPoint*)
  * @param out_tris: the indices of the vertices of the output triangles
  * @param out_labels: a vector of bitset containing, for each output triangle, the set of labels of the generating input triangles
+ * @param parallel: where and how wide the arrangement runs in parallel (see parallel_config.h)
  *
  * IMPORTANT: if you use this function
  * - if, at some point, you need an approximation of your vertices you need to call the computeApproximateCoordinates(...) function contained in processing.h
  * - remember to free the dynamic allocated memory of the implicit points by calling the freePointsMemory(...) function contained in processing.h
  */
 void solveIntersections(const std::vector<double> &in_coords, const std::vector<uint> &in_tris, const std::vector<uint> &in_labels, point_arena &arena,
-                               std::vector<genericPoint*> &vertices, std::vector<uint> &out_tris, std::vector< std::bitset<NBIT> > &out_labels);
+                               std::vector<genericPoint*> &vertices, std::vector<uint> &out_tris, std::vector< std::bitset<NBIT> > &out_labels,
+                               const ParallelConfig &parallel = ParallelConfig());
 
 
 //#include "solve_intersections.cpp"
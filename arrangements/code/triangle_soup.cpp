@@ -228,6 +228,15 @@ const genericPoint* TriangleSoup::edgeVert(uint e_id, uint off) const
 
 //:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
+uint TriangleSoup::edgeVertID(uint e_id, uint off) const
+{
+    assert(e_id < edges.size() && "e_id out of range");
+    if(off == 0) return edges[e_id].first;
+    else         return edges[e_id].second;
+}
+
+//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
 const double* TriangleSoup::edgeVertPtr(uint e_id, uint off) const
 {
     assert(e_id < edges.size() && "e_id out of range");
@@ -95,6 +95,8 @@ class TriangleSoup
 
         const genericPoint* edgeVert(uint e_id, uint off) const;
 
+        uint edgeVertID(uint e_id, uint off) const;
+
         const double* edgeVertPtr(uint e_id, uint off) const;
 
         uint edgeOppositeToVert(uint t_id, uint v_id) const;
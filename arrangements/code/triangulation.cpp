@@ -45,10 +45,12 @@
 
 //#include "../external/yocto/yocto_parallel.h"
 #include "utils.h"
+#include "delaunay.h"
 
 #include <tbb/tbb.h>
 
-void triangulateSingleTriangle(TriangleSoup &ts, point_arena& arena, FastTrimesh &subm, uint t_id, AuxiliaryStructure &g, std::vector<uint> &new_tris, std::vector< std::bitset<NBIT> > &new_labels, tbb::spin_mutex& mutex)
+void triangulateSingleTriangle(TriangleSoup &ts, point_arena& arena, FastTrimesh &subm, uint t_id, AuxiliaryStructure &g, std::vector<uint> &new_tris, std::vector< std::bitset<NBIT> > &new_labels, tbb::spin_mutex& mutex,
+                               TriangulationEngine engine)
 {
     /*:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
      *                                  POINTS AND SEGMENTS RECOVERY
@@ -61,9 +63,9 @@ void triangulateSingleTriangle(TriangleSoup &ts, point_arena& arena, FastTrimesh
     int e2_id = ts.edgeID(subm.vertOrigID(2), subm.vertOrigID(0));      assert(e2_id != -1);
 
     auxvector<uint> e0_points, e1_points, e2_points;
-    sortedVertexListAlongSegment(ts, g.edgePointsList(static_cast<uint>(e0_id)), subm.vertOrigID(0), subm.vertOrigID(1), e0_points);
-    sortedVertexListAlongSegment(ts, g.edgePointsList(static_cast<uint>(e1_id)), subm.vertOrigID(1), subm.vertOrigID(2), e1_points);
-    sortedVertexListAlongSegment(ts, g.edgePointsList(static_cast<uint>(e2_id)), subm.vertOrigID(2), subm.vertOrigID(0), e2_points);
+    sortedEdgePointsList(ts, g, static_cast<uint>(e0_id), subm.vertOrigID(0), subm.vertOrigID(1), e0_points);
+    sortedEdgePointsList(ts, g, static_cast<uint>(e1_id), subm.vertOrigID(1), subm.vertOrigID(2), e1_points);
+    sortedEdgePointsList(ts, g, static_cast<uint>(e2_id), subm.vertOrigID(2), subm.vertOrigID(0), e2_points);
 
     auxvector<UIPair> t_segments(g.triangleSegmentsList(t_id).begin(), g.triangleSegmentsList(t_id).end());
 
@@ -74,7 +76,11 @@ void triangulateSingleTriangle(TriangleSoup &ts, point_arena& arena, FastTrimesh
      *                                  TRIANGLE SPLIT
      * :::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::*/
 
-    if(t_points.size() < 50)
+    const genericPoint *jolly = (engine == CONSTRAINED_DELAUNAY) ? nonCoplanarJollyPoint(ts, t_id) : nullptr;
+
+    if(engine == CONSTRAINED_DELAUNAY)
+        insertPointsDelaunay(ts, subm, t_points, jolly);
+    else if(t_points.size() < 50)
         splitSingleTriangle(ts, subm, t_points);
     else
         splitSingleTriangleWithTree(ts, subm, t_points);
@@ -88,12 +94,16 @@ void triangulateSingleTriangle(TriangleSoup &ts, point_arena& arena, FastTrimesh
     splitSingleEdge(ts, subm, 1, 2, e1_points);
     splitSingleEdge(ts, subm, 2, 0, e2_points);
 
+    if(engine == CONSTRAINED_DELAUNAY) delaunayFlips(subm, jolly);
+
     /*:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
      *                           CONSTRAINT SEGMENT INSERTION
      * :::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::*/
 
     addConstraintSegmentsInSingleTriangle(ts, arena, subm, g, t_segments, mutex);
 
+    if(engine == CONSTRAINED_DELAUNAY && !t_segments.empty()) delaunayFlips(subm, jolly);
+
     /*:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
      *                      POCKETS IN COPLANAR TRIANGLES SOLVING
      * :::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::*/
@@ -125,13 +135,18 @@ void triangulateSingleTriangle(TriangleSoup &ts, point_arena& arena, FastTrimesh
     }
 }
 
-void triangulation(TriangleSoup &ts, point_arena& arena, AuxiliaryStructure &g, std::vector<uint> &new_tris, std::vector< std::bitset<NBIT> > &new_labels)
+void triangulation(TriangleSoup &ts, point_arena& arena, AuxiliaryStructure &g, std::vector<uint> &new_tris, std::vector< std::bitset<NBIT> > &new_labels,
+                   TriangulationEngine engine, const CancellationToken *cancel,
+                   TriangulationSchedule schedule, bool parallel)
 {
     new_labels.clear();
     new_tris.clear();
     new_tris.reserve(2 * 3 * ts.numTris());
     new_labels.reserve(2 * ts.numTris());
 
+    // each edge is shared by two or more triangles: its points are sorted once here
+    if(!g.edgePointsListsAreSorted()) g.sortEdgePointsLists(ts, parallel);
+
     std::vector<uint> tris_to_split;
     tris_to_split.reserve(ts.numTris());
 
@@ -149,18 +164,80 @@ void triangulation(TriangleSoup &ts, point_arena& arena, AuxiliaryStructure &g,
         }
     }
 
-    // processing the triangles to split
     tbb::spin_mutex mutex;
-    tbb::parallel_for((uint)0, (uint)tris_to_split.size(), [&](uint t) {
-        uint t_id = tris_to_split[t];
-        FastTrimesh subm(ts.triVert(t_id, 0),
-                         ts.triVert(t_id, 1),
-                         ts.triVert(t_id, 2),
-                         ts.tri(t_id),
-                         ts.triPlane(t_id));
-
-        triangulateSingleTriangle(ts, arena, subm, t_id, g, new_tris, new_labels, mutex);
+    auto split_range = [&](const tbb::blocked_range<uint> &r)
+    {
+        for(uint t = r.begin(); t != r.end(); t++)
+        {
+            if(stopRequested(cancel)) return;
+
+            uint t_id = tris_to_split[t];
+            FastTrimesh subm(ts.triVert(t_id, 0),
+                             ts.triVert(t_id, 1),
+                             ts.triVert(t_id, 2),
+                             ts.tri(t_id),
+                             ts.triPlane(t_id));
+
+            triangulateSingleTriangle(ts, arena, subm, t_id, g, new_tris, new_labels, mutex, engine);
+        }
+    };
+
+    if(!parallel)
+    {
+        split_range(tbb::blocked_range<uint>(0, (uint)tris_to_split.size()));
+        return;
+    }
+
+    if(schedule == INPUT_ORDER)
+    {
+        tbb::parallel_for(tbb::blocked_range<uint>(0, (uint)tris_to_split.size()), split_range);
+        return;
+    }
+
+    // the cost of a triangle varies by orders of magnitude, so the heaviest
+    // ones are scheduled first to avoid a long tail at the end of the loop
+    sortTrianglesByEstimatedCost(ts, g, tris_to_split);
+
+    // processing the triangles to split (one task per triangle, so that idle
+    // workers can steal the remaining ones)
+    tbb::parallel_for(tbb::blocked_range<uint>(0, (uint)tris_to_split.size(), 1), split_range, tbb::simple_partitioner());
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+uint64_t estimateTriangulationCost(const TriangleSoup &ts, const AuxiliaryStructure &g, uint t_id)
+{
+    uint64_t num_t_points = g.trianglePointsList(t_id).size();
+    uint64_t num_e_points = g.edgePointsList(ts.triEdgeID(t_id, 0)).size() +
+                            g.edgePointsList(ts.triEdgeID(t_id, 1)).size() +
+                            g.edgePointsList(ts.triEdgeID(t_id, 2)).size();
+    uint64_t num_segments = g.triangleSegmentsList(t_id).size();
+
+    // point location is linear per point below the tree threshold (see triangulateSingleTriangle)
+    uint64_t split_cost = (num_t_points < 50) ? num_t_points * num_t_points : 50 * num_t_points;
+
+    // each constraint segment walks through the sub-mesh, whose size grows with the points inserted
+    uint64_t num_verts = 3 + num_t_points + num_e_points;
+    uint64_t segs_cost = num_segments * num_verts;
+
+    if(g.triangleHasCoplanars(t_id)) segs_cost *= 2; // pockets detection
+
+    return 1 + num_verts + split_cost + segs_cost;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+void sortTrianglesByEstimatedCost(const TriangleSoup &ts, const AuxiliaryStructure &g, std::vector<uint> &tris)
+{
+    std::vector< std::pair<uint64_t, uint> > cost_tris(tris.size());
+
+    tbb::parallel_for((uint)0, (uint)tris.size(), [&](uint i) {
+        cost_tris[i] = std::make_pair(estimateTriangulationCost(ts, g, tris[i]), tris[i]);
     });
+
+    tbb::parallel_sort(cost_tris.begin(), cost_tris.end(), std::greater< std::pair<uint64_t, uint> >());
+
+    for(uint i = 0; i < cost_tris.size(); i++) tris[i] = cost_tris[i].second;
 }
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
@@ -642,65 +719,9 @@ void boundaryWalker(const FastTrimesh &subm, uint v_start, uint v_stop, iterator
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
-void earcut(const FastTrimesh &subm, std::vector<uint> &poly, std::vector<uint> &tris, const Plane &ref_p, const int &orientation)
-{
-    if(poly.size() < 3) return;
-
-    if(poly.size() == 3)
-    {
-        for(uint v_id : poly) tris.push_back(v_id);
-        return;
-    }
-
-    while(true)
-    {
-        if(poly.size() == 3)
-        {
-            for(uint v_id : poly)
-                tris.push_back(v_id);
-            return;
-        }
-
-        for(uint i = 1; i < poly.size()-1; ++i)
-        {
-            uint curr = poly.at(i);
-            uint next = poly.at(i + 1);
-            uint prev = poly.at(i - 1);
-
-            if(prev == next) continue; // dangling edge: not even do the ear test...
-
-            const genericPoint *prev_p = subm.vert(prev);
-            const genericPoint *curr_p = subm.vert(curr);
-            const genericPoint *next_p = subm.vert(next);
-
-            //auto t2 = tic();
-            int check = customOrient2D(prev_p, curr_p, next_p, ref_p);
-            //time_ORIENT += toc(t2);
-
-            if( (check > 0 && orientation > 0) || (check < 0 && orientation < 0)) // found a candidate ear
-            {
-                tris.push_back(prev);
-                tris.push_back(curr);
-                tris.push_back(next);
-
-                // remove curr vert
-                poly.erase(poly.begin() + i);
-
-                if(poly.size() == 3)
-                {
-                    tris.push_back(poly.at(0));
-                    tris.push_back(poly.at(1));
-                    tris.push_back(poly.at(2));
-                    return;
-                }
-                i--;
-            }
-        }
-    }
-}
-
-//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
-
+// The polygons come from the triangles crossed by a constrained edge, so they are visible from it:
+// every convex corner (but the edge endpoints) is an ear, and no point-in-ear test is needed.
+// Each corner is tested once at the beginning and at most twice more when a neighbour is cut
 void earcutLinear(const FastTrimesh &subm, const std::vector<uint> &poly, std::vector<uint> &tris, const int &orientation)
 {
     assert(poly.size() >= 3 && "no valid poly dimension");
@@ -804,9 +825,9 @@ uint createTPI(TriangleSoup &ts, point_arena& arena, FastTrimesh &subm, const UI
     std::vector<const genericPoint*> tv0 = computeTriangleOfSegment(ts, e0, t0_ids, g, sub_segs_map);
     std::vector<const genericPoint*> tv1 = computeTriangleOfSegment(ts, e1, t0_ids, g, sub_segs_map);
 
-    implicitPoint3D_TPI *new_v = &arena.tpi.emplace_back(tv[0]->toExplicit3D(), tv[1]->toExplicit3D(), tv[2]->toExplicit3D(),
-                                                         tv0[0]->toExplicit3D(), tv0[1]->toExplicit3D(), tv0[2]->toExplicit3D(),
-                                                         tv1[0]->toExplicit3D(), tv1[1]->toExplicit3D(), tv1[2]->toExplicit3D());
+    genericPoint *new_v = newTPI(arena, tv[0]->toExplicit3D(), tv[1]->toExplicit3D(), tv[2]->toExplicit3D(),
+                                        tv0[0]->toExplicit3D(), tv0[1]->toExplicit3D(), tv0[2]->toExplicit3D(),
+                                        tv1[0]->toExplicit3D(), tv1[1]->toExplicit3D(), tv1[2]->toExplicit3D());
 
 
     // we check if the new_tpi as already been inserted
@@ -815,7 +836,7 @@ uint createTPI(TriangleSoup &ts, point_arena& arena, FastTrimesh &subm, const UI
 
     if(ins.second == false) //vtx already present
     {
-        arena.tpi.pop_back();
+        popTPI(arena);
         return ins.first;
     }
 
@@ -1139,7 +1160,14 @@ void sortedVertexListAlongSegment(const TriangleSoup &ts, const auxvector<uint>
         sorted.push_back(std::make_pair(ts.vert(v_id), v_id));
     }
 
-    std::sort(sorted.begin(), sorted.end(), lessThanP);
+    {
+        // the whole sort runs with upward rounding, the scope is suspended only for the uncertain comparisons
+        upwardRoundingScope scope;
+        std::sort(sorted.begin(), sorted.end(), [&](const std::pair<const genericPoint*, uint> &a, const std::pair<const genericPoint*, uint> &b)
+        {
+            return (scope.refine(genericPoint::lessThanFilter(*a.first, *b.first), [&]() { return genericPoint::lessThan(*a.first, *b.first); }) < 0);
+        });
+    }
 
     out_point_list.reserve(sorted.size());
 
@@ -1157,4 +1185,24 @@ void sortedVertexListAlongSegment(const TriangleSoup &ts, const auxvector<uint>
     assert(out_point_list[0] == v0_id && out_point_list.back() == v1_id && "Sorted list not correct");
 }
 
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
+void sortedEdgePointsList(const TriangleSoup &ts, const AuxiliaryStructure &g, uint e_id, uint v0_id, uint v1_id, auxvector<uint> &out_point_list)
+{
+    assert(g.edgePointsListsAreSorted());
+
+    const auxvector<uint> &point_list = g.edgePointsList(e_id);
+    if(point_list.size() == 0) return;
+
+    out_point_list.reserve(point_list.size() + 2);
+    out_point_list.push_back(v0_id);
+
+    if(ts.edgeVertID(e_id, 0) == v0_id)
+        out_point_list.insert(out_point_list.end(), point_list.begin(), point_list.end());
+    else
+        out_point_list.insert(out_point_list.end(), point_list.rbegin(), point_list.rend());
+
+    out_point_list.push_back(v1_id);
+
+    assert(ts.edgeVertID(e_id, 0) == v0_id || ts.edgeVertID(e_id, 1) == v0_id);
+}
@@ -45,6 +45,7 @@
 #include "triangle_soup.h"
 #include "fast_trimesh.h"
 #include "tree.h"
+#include "cancellation.h"
 
 #pragma GCC diagnostic ignored "-Wfloat-equal"
 
@@ -60,9 +61,20 @@ inline bool lessThanP(std::pair<const genericPoint*, uint> &a, std::pair<const g
 }
 
 
-void triangulation(TriangleSoup &ts, point_arena& arena, AuxiliaryStructure &g, std::vector<uint> &new_tris, std::vector<std::bitset<NBIT> > &new_labels);
+// if cancel requests a stop, the remaining triangles are skipped and the output is incomplete.
+// If parallel is false the triangles are split one after the other, in input order, and schedule is ignored
+void triangulation(TriangleSoup &ts, point_arena& arena, AuxiliaryStructure &g, std::vector<uint> &new_tris, std::vector<std::bitset<NBIT> > &new_labels,
+                   TriangulationEngine engine = SPLIT_AND_WALK, const CancellationToken *cancel = nullptr,
+                   TriangulationSchedule schedule = INPUT_ORDER, bool parallel = true);
 
-void triangulateSingleTriangle(TriangleSoup &ts, FastTrimesh &subm, uint t_id, AuxiliaryStructure &g, std::vector<uint> &new_tris, std::vector<std::bitset<NBIT> > &new_labels);
+// estimated work needed to split t_id, based on the number of points and constraint segments it contains
+uint64_t estimateTriangulationCost(const TriangleSoup &ts, const AuxiliaryStructure &g, uint t_id);
+
+// sorts tris by decreasing estimated cost, so that the heaviest triangles are scheduled first
+void sortTrianglesByEstimatedCost(const TriangleSoup &ts, const AuxiliaryStructure &g, std::vector<uint> &tris);
+
+void triangulateSingleTriangle(TriangleSoup &ts, point_arena& arena, FastTrimesh &subm, uint t_id, AuxiliaryStructure &g, std::vector<uint> &new_tris, std::vector<std::bitset<NBIT> > &new_labels, tbb::spin_mutex& mutex,
+                               TriangulationEngine engine = SPLIT_AND_WALK);
 
 void splitSingleTriangle(const TriangleSoup &ts, FastTrimesh &subm, const std::vector<uint> &points);
 void splitSingleTriangle(const TriangleSoup &ts, FastTrimesh &subm, const auxvector<uint> &points);
@@ -88,8 +100,6 @@ void findIntersectingElements(TriangleSoup &ts, point_arena& arena, FastTrimesh
 template<typename iterator>
 void boundaryWalker(const FastTrimesh &subm, uint v_start, uint v_stop, iterator curr_p, iterator curr_e, std::vector<uint> &h);
 
-void earcut(const FastTrimesh &subm, std::vector<uint> &poly, std::vector<uint> &tris, const Plane &ref_p, const int &orientation);
-
 void earcutLinear(const FastTrimesh &subm, const std::vector<uint> &poly, std::vector<uint> &tris, const int &orientation);
 
 uint createTPI(TriangleSoup &ts, point_arena& arena, FastTrimesh &subm, const UIPair &e0, const UIPair &e1, AuxiliaryStructure &g, const phmap::flat_hash_map< UIPair, UIPair > &sub_segs_map);
@@ -121,6 +131,9 @@ int customOrient2D(const genericPoint *p0, const genericPoint *p1, const generic
 void sortedVertexListAlongSegment(const TriangleSoup &ts, const std::vector<uint> &point_list, uint v0_id, uint v1_id, std::vector<uint> &res);
 void sortedVertexListAlongSegment(const TriangleSoup &ts, const auxvector<uint> &point_list, uint v0_id, uint v1_id, auxvector<uint> &res);
 
+// same output of sortedVertexListAlongSegment, read from the edge lists pre-sorted by AuxiliaryStructure::sortEdgePointsLists
+void sortedEdgePointsList(const TriangleSoup &ts, const AuxiliaryStructure &g, uint e_id, uint v0_id, uint v1_id, auxvector<uint> &res);
+
 
 //#include "triangulation.cpp"
 
@@ -155,6 +155,7 @@ bool contains(const absl::InlinedVector<T, N>& values, T value) {
 template<typename T, size_t N>
 struct bucket_arena {
   std::vector<std::vector<T>> buckets;
+  size_t peak_buckets = 0; // most buckets held at once since the last resetPeak()
 
   bucket_arena() {
     buckets.reserve(16);
@@ -165,6 +166,7 @@ struct bucket_arena {
     if(buckets.empty() || buckets.back().capacity() == buckets.back().size()) {
       auto& bucket = buckets.emplace_back();
       bucket.reserve(N);
+      peak_buckets = std::max(peak_buckets, buckets.size());
       return bucket.emplace_back(std::forward<Args>(args)...);
     } else {
       auto& bucket = buckets.back();
@@ -176,6 +178,16 @@ struct bucket_arena {
     buckets.back().pop_back();
     if(buckets.back().empty()) buckets.pop_back();
   }
+
+  size_t size() const {
+    size_t n = 0;
+    for(auto& bucket : buckets) n += bucket.size();
+    return n;
+  }
+
+  size_t bytes() const { return buckets.size() * N * sizeof(T); }
+  size_t peakBytes() const { return peak_buckets * N * sizeof(T); }
+  void resetPeak() { peak_buckets = buckets.size(); }
 };
 
 struct point_arena {
@@ -183,6 +195,27 @@ struct point_arena {
   bucket_arena<implicitPoint3D_LPI, 1024 * 1024> edges;
   bucket_arena<explicitPoint3D, 1024> jolly;
   bucket_arena<implicitPoint3D_TPI, 1024 * 1024> tpi;
+  implicitPointTable indexed{&init};
+
+  size_t numLPI() const { return edges.size() + indexed.numLPI(); }
+  size_t numTPI() const { return tpi.size() + indexed.numTPI(); }
+
+  // memory held by the points, in bytes
+  size_t bytes() const {
+    return init.capacity() * sizeof(explicitPoint3D) + edges.bytes() + jolly.bytes() + tpi.bytes() + indexed.bytes();
+  }
+
+  // most memory held by the points since the last resetPeak(), in bytes. Only the buckets
+  // can be released (popLPI/popTPI), init and indexed never shrink
+  size_t peakBytes() const {
+    return init.capacity() * sizeof(explicitPoint3D) + edges.peakBytes() + jolly.peakBytes() + tpi.peakBytes() + indexed.bytes();
+  }
+
+  void resetPeak() {
+    edges.resetPeak();
+    jolly.resetPeak();
+    tpi.resetPeak();
+  }
 };
 
 #else
@@ -192,8 +225,68 @@ struct point_arena {
   std::deque<implicitPoint3D_LPI> edges;
   std::deque<explicitPoint3D> jolly;
   std::deque<implicitPoint3D_TPI> tpi;
+  implicitPointTable indexed{&init};
+
+  size_t numLPI() const { return edges.size() + indexed.numLPI(); }
+  size_t numTPI() const { return tpi.size() + indexed.numTPI(); }
+
+  // memory held by the points, in bytes
+  size_t bytes() const {
+    return init.capacity() * sizeof(explicitPoint3D) + edges.size() * sizeof(implicitPoint3D_LPI) +
+           jolly.size() * sizeof(explicitPoint3D) + tpi.size() * sizeof(implicitPoint3D_TPI) + indexed.bytes();
+  }
+
+  // the deques give back at most one point per popLPI/popTPI, the peak is not tracked
+  size_t peakBytes() const { return bytes(); }
+  void resetPeak() {}
 };
 
 #endif
 
+// if defined (ENABLE_COMPACT_IMPLICIT_POINTS in CMake), LPI and TPI points are created in
+// point_arena::indexed (32-bit indices to the defining points, SoA filter cache) instead of
+// the edges/tpi arenas (references). It saves 12 bytes per LPI and 28 per TPI
+//#define COMPACT_IMPLICIT_POINTS
+
+inline genericPoint* newLPI(point_arena& arena, const explicitPoint3D& p, const explicitPoint3D& q,
+                            const explicitPoint3D& r, const explicitPoint3D& s, const explicitPoint3D& t)
+{
+#ifdef COMPACT_IMPLICIT_POINTS
+  return &arena.indexed.addLPI(p, q, r, s, t);
+#else
+  return &arena.edges.emplace_back(p, q, r, s, t);
+#endif
+}
+
+// removes the last point created by newLPI
+inline void popLPI(point_arena& arena)
+{
+#ifdef COMPACT_IMPLICIT_POINTS
+  arena.indexed.popLPI();
+#else
+  arena.edges.pop_back();
+#endif
+}
+
+inline genericPoint* newTPI(point_arena& arena, const explicitPoint3D& v1, const explicitPoint3D& v2, const explicitPoint3D& v3,
+                            const explicitPoint3D& w1, const explicitPoint3D& w2, const explicitPoint3D& w3,
+                            const explicitPoint3D& u1, const explicitPoint3D& u2, const explicitPoint3D& u3)
+{
+#ifdef COMPACT_IMPLICIT_POINTS
+  return &arena.indexed.addTPI(v1, v2, v3, w1, w2, w3, u1, u2, u3);
+#else
+  return &arena.tpi.emplace_back(v1, v2, v3, w1, w2, w3, u1, u2, u3);
+#endif
+}
+
+// removes the last point created by newTPI
+inline void popTPI(point_arena& arena)
+{
+#ifdef COMPACT_IMPLICIT_POINTS
+  arena.indexed.popTPI();
+#else
+  arena.tpi.pop_back();
+#endif
+}
+
 #endif
@@ -35,6 +35,7 @@
 
 inline int orient2d_filtered(double p1x, double p1y, double p2x, double p2y, double p3x, double p3y)
 {
+	COUNT_PREDICATE_STAGE(PF_ORIENT2D, PS_FILTER);
 	double dl = (p2x - p1x) * (p3y - p1y);
 	double dr = (p2y - p1y) * (p3x - p1x);
 	double det = dl - dr;
@@ -44,6 +45,7 @@ inline int orient2d_filtered(double p1x, double p1y, double p2x, double p2y, dou
 
 inline int orient2d_interval(interval_number p1x, interval_number p1y, interval_number p2x, interval_number p2y, interval_number p3x, interval_number p3y)
 {
+	COUNT_PREDICATE_STAGE(PF_ORIENT2D, PS_INTERVAL);
    setFPUModeToRoundUP();
    interval_number a11(p2x - p1x);
    interval_number a12(p2y - p1y);
@@ -60,6 +62,7 @@ inline int orient2d_interval(interval_number p1x, interval_number p1y, interval_
 
 inline int orient2d_exact(double p1x, double p1y, double p2x, double p2y, double p3x, double p3y)
 {
+	COUNT_PREDICATE_STAGE(PF_ORIENT2D, PS_EXACT);
     double acx[2], acy[2], bcx[2], bcy[2], dtl[2], dtr[2], B[4];
     double s[2], t[2], u[4], C1[8], C2[12], D[16];
     int C1l, C2l, Dl;
@@ -122,6 +125,7 @@ inline int orient2d(double p1x, double p1y, double p2x, double p2y, double p3x,
 
 inline int orient3d_filtered(double px, double py, double pz, double qx, double qy, double qz, double rx, double ry, double rz, double sx, double sy, double sz)
 {
+	COUNT_PREDICATE_STAGE(PF_ORIENT3D, PS_FILTER);
 	double fadx, fbdx, fcdx, fady, fbdy, fcdy, fadz, fbdz, fcdz, eb;
 	double fbdxcdy, fcdxbdy, fcdxady, fadxcdy, fadxbdy, fbdxady, det;
 
@@ -140,6 +144,7 @@ inline int orient3d_filtered(double px, double py, double pz, double qx, double
 
 inline int orient3d_interval(interval_number px, interval_number py, interval_number pz, interval_number qx, interval_number qy, interval_number qz, interval_number rx, interval_number ry, interval_number rz, interval_number sx, interval_number sy, interval_number sz)
 {
+	COUNT_PREDICATE_STAGE(PF_ORIENT3D, PS_INTERVAL);
    setFPUModeToRoundUP();
    interval_number qx_px(qx - px);
    interval_number qy_py(qy - py);
@@ -242,6 +247,7 @@ inline void supo3d2(
 
 inline int orient3d_exact(double pdx, double pdy, double pdz, double pax, double pay, double paz, double pbx, double pby, double pbz, double pcx, double pcy, double pcz)
 {
+	COUNT_PREDICATE_STAGE(PF_ORIENT3D, PS_EXACT);
 	double eb, det;
 	double adx[2], bdx[2], cdx[2], ady[2], bdy[2], cdy[2], adz[2], bdz[2], cdz[2];
 	double bdxcdy[2], cdxbdy[2], cdxady[2], adxcdy[2], adxbdy[2], bdxady[2];
@@ -397,3 +403,115 @@ inline int orient3d(double px, double py, double pz, double qx, double qy, doubl
    //if (ret != Filtered_Sign::UNCERTAIN) return ret;
    return orient3d_exact(px, py, pz, qx, qy, qz, rx, ry, rz, sx, sy, sz);
 }
+
+
+// Four-wide versions of the semi-static filters above, for long sequences of predicates on explicit points.
+// Each point is given as a pointer to its coordinates (x, y for orient2d and x, y, z for orient3d).
+// res[i] is the sign computed by orient?d_filtered on the i-th tuple, that is 0 if uncertain.
+// Lanes perform exactly the same floating point operations of the scalar filters, so results coincide.
+// The AVX2 version is used whenever the compiler targets AVX2 (/arch:AVX2, -mavx2). It does not depend on
+// USE_AVX2_INSTRUCTIONS, which also switches the interval arithmetic to SIMD and is only set for MSVC.
+
+#if defined(USE_AVX2_INSTRUCTIONS) || defined(__AVX2__)
+
+#include <immintrin.h>
+
+inline void orient2d_filtered_x4(const double* const* p1, const double* const* p2, const double* const* p3, int* res)
+{
+	COUNT_PREDICATE_STAGE_N(PF_ORIENT2D, PS_FILTER, 4);
+
+	const __m256d abs_mask = _mm256_castsi256_pd(_mm256_set1_epi64x(~LLONG_MIN));
+
+	const __m256d p1x = _mm256_set_pd(p1[3][0], p1[2][0], p1[1][0], p1[0][0]);
+	const __m256d p1y = _mm256_set_pd(p1[3][1], p1[2][1], p1[1][1], p1[0][1]);
+	const __m256d p2x = _mm256_set_pd(p2[3][0], p2[2][0], p2[1][0], p2[0][0]);
+	const __m256d p2y = _mm256_set_pd(p2[3][1], p2[2][1], p2[1][1], p2[0][1]);
+	const __m256d p3x = _mm256_set_pd(p3[3][0], p3[2][0], p3[1][0], p3[0][0]);
+	const __m256d p3y = _mm256_set_pd(p3[3][1], p3[2][1], p3[1][1], p3[0][1]);
+
+	const __m256d dl = _mm256_mul_pd(_mm256_sub_pd(p2x, p1x), _mm256_sub_pd(p3y, p1y));
+	const __m256d dr = _mm256_mul_pd(_mm256_sub_pd(p2y, p1y), _mm256_sub_pd(p3x, p1x));
+	const __m256d det = _mm256_sub_pd(dl, dr);
+	const __m256d eb = _mm256_mul_pd(_mm256_set1_pd(3.3306690738754706e-016), _mm256_add_pd(_mm256_and_pd(dl, abs_mask), _mm256_and_pd(dr, abs_mask)));
+
+	const int pos = _mm256_movemask_pd(_mm256_cmp_pd(det, eb, _CMP_GE_OQ));
+	const int neg = _mm256_movemask_pd(_mm256_cmp_pd(_mm256_xor_pd(det, _mm256_set1_pd(-0.0)), eb, _CMP_GE_OQ));
+	for (int i = 0; i < 4; i++) res[i] = ((pos >> i) & 1) - ((neg >> i) & 1);
+}
+
+inline void orient3d_filtered_x4(const double* const* p, const double* const* q, const double* const* r, const double* const* s, int* res)
+{
+	COUNT_PREDICATE_STAGE_N(PF_ORIENT3D, PS_FILTER, 4);
+
+	const __m256d abs_mask = _mm256_castsi256_pd(_mm256_set1_epi64x(~LLONG_MIN));
+
+	const __m256d px = _mm256_set_pd(p[3][0], p[2][0], p[1][0], p[0][0]);
+	const __m256d py = _mm256_set_pd(p[3][1], p[2][1], p[1][1], p[0][1]);
+	const __m256d pz = _mm256_set_pd(p[3][2], p[2][2], p[1][2], p[0][2]);
+
+	const __m256d fadx = _mm256_sub_pd(_mm256_set_pd(q[3][0], q[2][0], q[1][0], q[0][0]), px);
+	const __m256d fady = _mm256_sub_pd(_mm256_set_pd(q[3][1], q[2][1], q[1][1], q[0][1]), py);
+	const __m256d fadz = _mm256_sub_pd(_mm256_set_pd(q[3][2], q[2][2], q[1][2], q[0][2]), pz);
+	const __m256d fbdx = _mm256_sub_pd(_mm256_set_pd(r[3][0], r[2][0], r[1][0], r[0][0]), px);
+	const __m256d fbdy = _mm256_sub_pd(_mm256_set_pd(r[3][1], r[2][1], r[1][1], r[0][1]), py);
+	const __m256d fbdz = _mm256_sub_pd(_mm256_set_pd(r[3][2], r[2][2], r[1][2], r[0][2]), pz);
+	const __m256d fcdx = _mm256_sub_pd(_mm256_set_pd(s[3][0], s[2][0], s[1][0], s[0][0]), px);
+	const __m256d fcdy = _mm256_sub_pd(_mm256_set_pd(s[3][1], s[2][1], s[1][1], s[0][1]), py);
+	const __m256d fcdz = _mm256_sub_pd(_mm256_set_pd(s[3][2], s[2][2], s[1][2], s[0][2]), pz);
+
+	const __m256d fbdxcdy = _mm256_mul_pd(_mm256_mul_pd(fbdx, fcdy), fadz);
+	const __m256d fcdxbdy = _mm256_mul_pd(_mm256_mul_pd(fcdx, fbdy), fadz);
+	const __m256d fcdxady = _mm256_mul_pd(_mm256_mul_pd(fcdx, fady), fbdz);
+	const __m256d fadxcdy = _mm256_mul_pd(_mm256_mul_pd(fadx, fcdy), fbdz);
+	const __m256d fadxbdy = _mm256_mul_pd(_mm256_mul_pd(fadx, fbdy), fcdz);
+	const __m256d fbdxady = _mm256_mul_pd(_mm256_mul_pd(fbdx, fady), fcdz);
+
+	const __m256d det = _mm256_add_pd(_mm256_add_pd(_mm256_sub_pd(fbdxcdy, fcdxbdy), _mm256_sub_pd(fcdxady, fadxcdy)), _mm256_sub_pd(fadxbdy, fbdxady));
+
+	__m256d sum = _mm256_add_pd(_mm256_and_pd(fbdxcdy, abs_mask), _mm256_and_pd(fcdxbdy, abs_mask));
+	sum = _mm256_add_pd(sum, _mm256_and_pd(fcdxady, abs_mask));
+	sum = _mm256_add_pd(sum, _mm256_and_pd(fadxcdy, abs_mask));
+	sum = _mm256_add_pd(sum, _mm256_and_pd(fadxbdy, abs_mask));
+	sum = _mm256_add_pd(sum, _mm256_and_pd(fbdxady, abs_mask));
+	const __m256d eb = _mm256_mul_pd(_mm256_set1_pd(7.7715611723761027e-016), sum);
+
+	const int pos = _mm256_movemask_pd(_mm256_cmp_pd(det, eb, _CMP_GE_OQ));
+	const int neg = _mm256_movemask_pd(_mm256_cmp_pd(_mm256_xor_pd(det, _mm256_set1_pd(-0.0)), eb, _CMP_GE_OQ));
+	for (int i = 0; i < 4; i++) res[i] = ((pos >> i) & 1) - ((neg >> i) & 1);
+}
+
+#else
+
+inline void orient2d_filtered_x4(const double* const* p1, const double* const* p2, const double* const* p3, int* res)
+{
+	for (int i = 0; i < 4; i++) res[i] = orient2d_filtered(p1[i][0], p1[i][1], p2[i][0], p2[i][1], p3[i][0], p3[i][1]);
+}
+
+inline void orient3d_filtered_x4(const double* const* p, const double* const* q, const double* const* r, const double* const* s, int* res)
+{
+	for (int i = 0; i < 4; i++) res[i] = orient3d_filtered(p[i][0], p[i][1], p[i][2], q[i][0], q[i][1], q[i][2], r[i][0], r[i][1], r[i][2], s[i][0], s[i][1], s[i][2]);
+}
+
+#endif
+
+// Exact orient2d/orient3d on n tuples: the filter runs four tuples at a time, and only the
+// uncertain ones are resolved with the exact expansion-based predicate.
+inline void orient2dBatch(const double* const* p1, const double* const* p2, const double* const* p3, int* res, size_t n)
+{
+	size_t i = 0;
+	for (; i + 4 <= n; i += 4) orient2d_filtered_x4(p1 + i, p2 + i, p3 + i, res + i);
+	for (; i < n; i++) res[i] = orient2d_filtered(p1[i][0], p1[i][1], p2[i][0], p2[i][1], p3[i][0], p3[i][1]);
+
+	for (i = 0; i < n; i++)
+		if (res[i] == 0) res[i] = orient2d_exact(p1[i][0], p1[i][1], p2[i][0], p2[i][1], p3[i][0], p3[i][1]);
+}
+
+inline void orient3dBatch(const double* const* p, const double* const* q, const double* const* r, const double* const* s, int* res, size_t n)
+{
+	size_t i = 0;
+	for (; i + 4 <= n; i += 4) orient3d_filtered_x4(p + i, q + i, r + i, s + i, res + i);
+	for (; i < n; i++) res[i] = orient3d_filtered(p[i][0], p[i][1], p[i][2], q[i][0], q[i][1], q[i][2], r[i][0], r[i][1], r[i][2], s[i][0], s[i][1], s[i][2]);
+
+	for (i = 0; i < n; i++)
+		if (res[i] == 0) res[i] = orient3d_exact(p[i][0], p[i][1], p[i][2], q[i][0], q[i][1], q[i][2], r[i][0], r[i][1], r[i][2], s[i][0], s[i][1], s[i][2]);
+}
@@ -30,6 +30,12 @@
 #pragma fenv_access(on)
 #include "numerics.h"
 #include <iostream>
+#include <vector>
+#include <cstdint>
+#include <atomic>
+#include <unordered_map>
+#include <mutex>
+#include <stdexcept>
 
 // An indirect predicate can assume one of the following values.
 // UNDEFINED means that input parameters are degenerate and do not define an
@@ -55,7 +61,33 @@ enum Point_Type {
 	EXPLICIT3D = 3,
 	LPI = 4, // Line-plane intersection
 	TPI = 5, // Three-planes intersection
-	LNC = 6  // Linear combination
+	LNC = 6, // Linear combination
+	LPI_IDX = 7, // Line-plane intersection stored in an implicitPointTable
+	TPI_IDX = 8  // Three-planes intersection stored in an implicitPointTable
+};
+
+// Keeps the rounding mode upward during its lifetime, so that the interval filters evaluated
+// meanwhile (genericPoint::*Filter) do not switch it back and forth.
+// Exact stages and explicit-point filters need rounding to nearest: complete predicates must be
+// evaluated with the scope suspended, e.g. through refine(). Scopes cannot be nested.
+class upwardRoundingScope {
+public:
+	upwardRoundingScope() { resume(); }
+	~upwardRoundingScope() { suspend(); }
+
+	void suspend() { fpu_upward_rounding_scope = false; switchFPUModeToRoundNEAR(); }
+	void resume() { switchFPUModeToRoundUP(); fpu_upward_rounding_scope = true; }
+
+	// Returns the result of a filter evaluated within the scope if it is certain,
+	// otherwise the result of the complete predicate pred(), evaluated with the scope suspended.
+	template<typename Predicate>
+	int refine(int filtered, Predicate pred) {
+		if (filtered != Filtered_Sign::UNCERTAIN) return filtered;
+		suspend();
+		const int ret = pred();
+		resume();
+		return ret;
+	}
 };
 
 // This is a generic point. It can be extended as either explicit or implicit point
@@ -75,6 +107,9 @@ public:
 	bool isLPI() const { return (type == LPI); }
 	bool isTPI() const { return (type == TPI); }
 	bool isLNC() const { return (type == LNC); }
+	bool isIndexedLPI() const { return (type == LPI_IDX); }
+	bool isIndexedTPI() const { return (type == TPI_IDX); }
+	bool isIndexed() const { return (type == LPI_IDX || type == TPI_IDX); }
 
 	// The following functions convert to explicit points.
 	// Use only after having verified the correct type through getType()
@@ -93,6 +128,7 @@ public:
 	class implicitPoint3D_LPI& toLPI() { return (implicitPoint3D_LPI&)(*this); }
 	class implicitPoint3D_TPI& toTPI() { return (implicitPoint3D_TPI&)(*this); }
 	class implicitPoint3D_LNC& toLNC() { return (implicitPoint3D_LNC&)(*this); }
+	class implicitPoint3D_IDX& toIndexed() { return (implicitPoint3D_IDX&)(*this); }
 
 	const class explicitPoint2D& toExplicit2D() const { return (explicitPoint2D&)(*this); }
 	const class implicitPoint2D_SSI& toSSI() const { return (implicitPoint2D_SSI&)(*this); }
@@ -100,6 +136,7 @@ public:
 	const class implicitPoint3D_LPI& toLPI() const { return (implicitPoint3D_LPI&)(*this); }
 	const class implicitPoint3D_TPI& toTPI() const { return (implicitPoint3D_TPI&)(*this); }
 	const class implicitPoint3D_LNC& toLNC() const { return (implicitPoint3D_LNC&)(*this); }
+	const class implicitPoint3D_IDX& toIndexed() const { return (implicitPoint3D_IDX&)(*this); }
 
 	// Calculates the first two cartesian coordinates. If the point is implicit, these
 	// coordinates are approximated due to floating point roundoff.
@@ -181,6 +218,27 @@ public:
 	// TRUE if the two points are coincident
 	static bool coincident(const genericPoint& a, const genericPoint& b) { return lessThan(a, b) == 0; }
 
+	// Interval filters of the predicates above, for 3D points.
+	// They return the sign if interval arithmetic can certify it, Filtered_Sign::UNCERTAIN otherwise.
+	// Called within an upwardRoundingScope, they do not switch the rounding mode.
+	static int orient2DxyFilter(const genericPoint& a, const genericPoint& b, const genericPoint& c);
+	static int orient2DyzFilter(const genericPoint& a, const genericPoint& b, const genericPoint& c);
+	static int orient2DzxFilter(const genericPoint& a, const genericPoint& b, const genericPoint& c);
+	static int orient3DFilter(const genericPoint& a, const genericPoint& b, const genericPoint& c, const genericPoint& d);
+	static int lessThanOnXFilter(const genericPoint& a, const genericPoint& b);
+	static int lessThanOnYFilter(const genericPoint& a, const genericPoint& b);
+	static int lessThanOnZFilter(const genericPoint& a, const genericPoint& b);
+	static int lessThanFilter(const genericPoint& a, const genericPoint& b);
+
+	// Batched predicates: res[i] = predicate(*a[i], *b[i], ...) for i in [0, n).
+	// The filters of all the n tuples are evaluated with a single pair of rounding mode
+	// switches, then the uncertain tuples are solved one by one with the complete predicate.
+	static void orient2DxyBatch(const genericPoint* const* a, const genericPoint* const* b, const genericPoint* const* c, int* res, size_t n);
+	static void orient2DyzBatch(const genericPoint* const* a, const genericPoint* const* b, const genericPoint* const* c, int* res, size_t n);
+	static void orient2DzxBatch(const genericPoint* const* a, const genericPoint* const* b, const genericPoint* const* c, int* res, size_t n);
+	static void orient3DBatch(const genericPoint* const* a, const genericPoint* const* b, const genericPoint* const* c, const genericPoint* const* d, int* res, size_t n);
+	static void lessThanBatch(const genericPoint* const* a, const genericPoint* const* b, int* res, size_t n);
+
 	// Let n = (x,y,z) be the normal of the triangle <v1,v2,v3>
 	// and let m be the absolute value of its largest component.
 	// That is, m = max(|x|, |y|, |z|).
@@ -436,6 +494,306 @@ public:
 };
 
 
+// LPI or TPI point stored in an implicitPointTable. The object is only a handle (16 bytes):
+// the defining explicit points and the cached filter values live in the table.
+class implicitPoint3D_IDX : public genericPoint {
+	uint32_t id;
+	const class implicitPointTable* tab;
+
+public:
+	implicitPoint3D_IDX() : genericPoint(Point_Type::UNDEF), id(0), tab(NULL) {}
+	implicitPoint3D_IDX(const Point_Type& t, uint32_t _id, const implicitPointTable* _tab) : genericPoint(t), id(_id), tab(_tab) {}
+
+	uint32_t ID() const { return id; }
+	const implicitPointTable& table() const { return *tab; }
+
+	// Number of explicit points defining the point (5 for LPIs, 9 for TPIs)
+	int numRefs() const { return (isIndexedLPI()) ? 5 : 9; }
+
+	// i-th defining point, in the order P,Q,R,S,T for LPIs and V1,V2,V3,W1,W2,W3,U1,U2,U3 for TPIs
+	const explicitPoint3D& ref(int i) const;
+
+	const explicitPoint3D& P() const { return ref(0); }
+	const explicitPoint3D& Q() const { return ref(1); }
+	const explicitPoint3D& R() const { return ref(2); }
+	const explicitPoint3D& S() const { return ref(3); }
+	const explicitPoint3D& T() const { return ref(4); }
+
+	const explicitPoint3D& V1() const { return ref(0); }
+	const explicitPoint3D& V2() const { return ref(1); }
+	const explicitPoint3D& V3() const { return ref(2); }
+	const explicitPoint3D& W1() const { return ref(3); }
+	const explicitPoint3D& W2() const { return ref(4); }
+	const explicitPoint3D& W3() const { return ref(5); }
+	const explicitPoint3D& U1() const { return ref(6); }
+	const explicitPoint3D& U2() const { return ref(7); }
+	const explicitPoint3D& U3() const { return ref(8); }
+
+	bool getIntervalLambda(interval_number& lx, interval_number& ly, interval_number& lz, interval_number& d) const;
+	void getExactLambda(double** lx, int& lxl, double** ly, int& lyl, double** lz, int& lzl, double** d, int& dl) const;
+	void getBigfloatLambda(bigfloat& lx, bigfloat& ly, bigfloat& lz, bigfloat& d) const;
+	bool getExactXYZCoordinates(bigrational& x, bigrational& y, bigrational& z) const;
+};
+
+
+// Compact storage for LPI and TPI points.
+// Defining points are stored as 32-bit indices instead of references: indices below
+// EXTRA_BIT address the explicit points in the base vector, the others address points
+// outside it that are registered one by one on first use (e.g. jolly points), and found again
+// through a hash map.
+// Filter values are cached in structure-of-arrays form, next to the indices.
+// Points, and the pointers to the chunks and to the extra points, live in fixed-size blocks
+// that are never moved, so that existing points can be read while new ones are appended.
+// Insertions and removals must be serialized by the caller.
+class implicitPointTable {
+public:
+	static const uint32_t EXTRA_BIT = 0x80000000u;
+
+	implicitPointTable(const std::vector<explicitPoint3D>* _base = NULL) : base(_base) {}
+	implicitPointTable(const implicitPointTable&) = delete;
+	implicitPointTable& operator=(const implicitPointTable&) = delete;
+
+	void setBase(const std::vector<explicitPoint3D>* _base) { base = _base; }
+
+	// Index of an explicit point, registering it if it does not belong to the base vector.
+	// Throws std::length_error if more than MAX_EXTRA points are registered
+	uint32_t explicitIndex(const explicitPoint3D& p);
+	const explicitPoint3D& explicitPoint(uint32_t i) const { return (i & EXTRA_BIT) ? *extra[i & ~EXTRA_BIT] : (*base)[i]; }
+
+	implicitPoint3D_IDX& addLPI(const explicitPoint3D& p, const explicitPoint3D& q,
+		const explicitPoint3D& r, const explicitPoint3D& s, const explicitPoint3D& t);
+
+	implicitPoint3D_IDX& addTPI(const explicitPoint3D& v1, const explicitPoint3D& v2, const explicitPoint3D& v3,
+		const explicitPoint3D& w1, const explicitPoint3D& w2, const explicitPoint3D& w3,
+		const explicitPoint3D& u1, const explicitPoint3D& u2, const explicitPoint3D& u3);
+
+	// Remove the last LPI/TPI added
+	void popLPI() { lpi.pop(); }
+	void popTPI() { tpi.pop(); }
+
+	uint32_t numLPI() const { return lpi.size; }
+	uint32_t numTPI() const { return tpi.size; }
+
+	// Memory held by the table, in bytes
+	size_t bytes() const {
+		return lpi.chunks.size * sizeof(Store<5>::Chunk) + tpi.chunks.size * sizeof(Store<9>::Chunk) +
+			lpi.chunks.bytes() + tpi.chunks.bytes() + extra.bytes() +
+			extra_index.bucket_count() * sizeof(void*) + extra_index.size() * (sizeof(std::pair<const explicitPoint3D*, uint32_t>) + sizeof(void*));
+	}
+
+	const explicitPoint3D& ref(const implicitPoint3D_IDX& p, int i) const {
+		return explicitPoint((p.isIndexedLPI()) ? lpi.refs(p.ID())[i] : tpi.refs(p.ID())[i]);
+	}
+
+	bool getIntervalLambda(const implicitPoint3D_IDX& p, interval_number& lx, interval_number& ly, interval_number& lz, interval_number& d) const {
+		return (p.isIndexedLPI()) ? lpi.getIntervalLambda(p.ID(), lx, ly, lz, d) : tpi.getIntervalLambda(p.ID(), lx, ly, lz, d);
+	}
+
+private:
+	static const uint32_t CHUNK_BITS = 14;
+	static const uint32_t CHUNK_SIZE = 1u << CHUNK_BITS;
+	static const uint32_t MAX_CHUNKS = 1u << (31 - CHUNK_BITS);
+	static const uint32_t MAX_EXTRA = 1u << 22;
+
+	// Append-only array, stored in blocks of 2^BLOCK_BITS elements allocated on demand.
+	// Neither the blocks nor the (small, fixed) array pointing to them are ever moved.
+	template<typename T, uint32_t BLOCK_BITS, uint32_t MAX_SIZE> struct BlockArray {
+		static const uint32_t BLOCK_SIZE = 1u << BLOCK_BITS;
+		static const uint32_t NUM_BLOCKS = MAX_SIZE / BLOCK_SIZE;
+
+		T* blocks[NUM_BLOCKS];
+		uint32_t size;
+
+		BlockArray() : size(0) { for (uint32_t i = 0; i < NUM_BLOCKS; i++) blocks[i] = NULL; }
+		~BlockArray() { for (uint32_t i = 0; i < NUM_BLOCKS; i++) delete[] blocks[i]; }
+		BlockArray(const BlockArray&) = delete;
+		BlockArray& operator=(const BlockArray&) = delete;
+
+		T& operator[](uint32_t i) const { return blocks[i >> BLOCK_BITS][i & (BLOCK_SIZE - 1)]; }
+
+		// Appends v, the caller checks that size < MAX_SIZE
+		void push_back(const T& v) {
+			if ((size & (BLOCK_SIZE - 1)) == 0) blocks[size >> BLOCK_BITS] = new T[BLOCK_SIZE];
+			(*this)[size] = v;
+			size++;
+		}
+
+		size_t bytes() const { return sizeof(blocks) + ((size + BLOCK_SIZE - 1) >> BLOCK_BITS) * BLOCK_SIZE * sizeof(T); }
+	};
+
+	// Points defined by N explicit points
+	template<int N> struct Store {
+		struct Chunk {
+			uint32_t refs[CHUNK_SIZE * N];
+			interval_number lx[CHUNK_SIZE], ly[CHUNK_SIZE], lz[CHUNK_SIZE], d[CHUNK_SIZE];
+			implicitPoint3D_IDX pts[CHUNK_SIZE];
+		};
+
+		BlockArray<Chunk*, 10, MAX_CHUNKS> chunks;
+		uint32_t size;
+
+		Store() : size(0) {}
+		~Store() { for (uint32_t i = 0; i < chunks.size; i++) delete chunks[i]; }
+
+		Chunk& chunk(uint32_t id) const { return *chunks[id >> CHUNK_BITS]; }
+		static uint32_t offset(uint32_t id) { return id & (CHUNK_SIZE - 1); }
+
+		const uint32_t* refs(uint32_t id) const { return chunk(id).refs + offset(id) * N; }
+
+		bool getIntervalLambda(uint32_t id, interval_number& lx, interval_number& ly, interval_number& lz, interval_number& d) const;
+
+		// Appends a point defined by the explicit points at indices ids, with the given filter values
+		implicitPoint3D_IDX& push(const uint32_t* ids, interval_number& lx, interval_number& ly, interval_number& lz, interval_number& d,
+			const Point_Type t, const implicitPointTable* tab);
+
+		void pop() { size--; }
+	};
+
+	const std::vector<explicitPoint3D>* base;
+	BlockArray<const explicitPoint3D*, 12, MAX_EXTRA> extra;
+	std::unordered_map<const explicitPoint3D*, uint32_t> extra_index; // position of each point in extra
+	Store<5> lpi;
+	Store<9> tpi;
+};
+
+// Uncomment the following to count how many times each stage of the predicates is reached.
+// Counters are kept per thread and only ever grow: to measure a run take collect() before
+// and after it and subtract (see predicateStageCounters::collectSince()).
+// When this is commented out the counting statements expand to nothing.
+//#define COUNT_PREDICATE_STAGES
+
+enum Predicate_Family {
+	PF_ORIENT2D = 0,
+	PF_ORIENT3D,
+	PF_LESSTHAN,
+	PF_INCIRCLE,
+	PF_INSPHERE,
+	PF_DOTPRODUCT,
+	PF_NUM_FAMILIES
+};
+
+enum Predicate_Stage {
+	PS_FILTER = 0, // semi-static floating point filter (explicit points only)
+	PS_INTERVAL,
+	PS_EXACT,      // expansion arithmetic
+	PS_BIGFLOAT,   // arbitrary precision, used when expansions under/overflow
+	PS_NUM_STAGES
+};
+
+// reached[f][s] is the number of predicates of family f that reached stage s.
+// The number of predicates resolved at a stage is the difference with the next one.
+struct PredicateStats {
+	bool enabled; // false if COUNT_PREDICATE_STAGES is not defined, counters are all zero
+	uint64_t reached[PF_NUM_FAMILIES][PS_NUM_STAGES];
+	uint64_t lambda_lookups; // exact lambdas requested to exactLambdaCache (CACHE_EXACT_LAMBDAS only)
+	uint64_t lambda_hits;    // exact lambdas found in its tables
+
+	static const char* familyName(int f);
+	static const char* stageName(int s);
+};
+
+// Counters are never reset, so that runs in flight on other threads are not affected.
+// Each thread only writes its own block; the relaxed atomics just make the concurrent
+// reads done by collect() well defined, they compile to plain loads and stores.
+// Runs that overlap in time on the same threads see each other's counts in their deltas.
+class predicateStageCounters {
+public:
+	static void count(Predicate_Family f, Predicate_Stage s, uint64_t n = 1)
+	{
+		std::atomic<uint64_t>& c = local().c[f][s];
+		c.store(c.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+	}
+
+	static void countLambdaLookup(bool hit)
+	{
+		Block& b = local();
+		b.lambda_lookups.store(b.lambda_lookups.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+		if (hit) b.lambda_hits.store(b.lambda_hits.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+	}
+
+	// Totals since the start of the program
+	static PredicateStats collect();
+
+	// Totals since 'start', which was returned by collect()
+	static PredicateStats collectSince(const PredicateStats& start);
+
+private:
+	struct Block {
+		std::atomic<uint64_t> c[PF_NUM_FAMILIES][PS_NUM_STAGES] = {};
+		std::atomic<uint64_t> lambda_lookups{ 0 }, lambda_hits{ 0 };
+	};
+
+	// Blocks of all the threads that counted something. They are never freed,
+	// so that counts survive the threads that produced them.
+	static inline std::mutex blocks_mutex;
+	static inline std::vector<Block*> blocks;
+
+	static Block& local();
+};
+
+#ifdef COUNT_PREDICATE_STAGES
+#define COUNT_PREDICATE_STAGE(f, s) predicateStageCounters::count(f, s)
+#define COUNT_PREDICATE_STAGE_N(f, s, n) predicateStageCounters::count(f, s, n)
+#define COUNT_LAMBDA_LOOKUP(hit) predicateStageCounters::countLambdaLookup(hit)
+#else
+#define COUNT_PREDICATE_STAGE(f, s)
+#define COUNT_PREDICATE_STAGE_N(f, s, n)
+#define COUNT_LAMBDA_LOOKUP(hit)
+#endif
+
+// Exact lambdas of LPI/TPI points are expensive, and in near-degenerate regions the same point
+// reaches the exact stage many times (e.g. sorting along edges, lookups in the vertex map).
+// When CACHE_EXACT_LAMBDAS is defined (ENABLE_EXACT_LAMBDA_CACHE in CMake), the exact lambda
+// of a point is computed once and kept in a per-thread side table, so that points do not grow.
+// The table is keyed by the coordinates of the defining explicit points, thus a point destroyed
+// and replaced by another at the same address can never hit a stale entry.
+//#define CACHE_EXACT_LAMBDAS
+
+#ifdef CACHE_EXACT_LAMBDAS
+class exactLambdaCache {
+public:
+	// Same as genericPoint::getExactLambda, for LPI/TPI points (classic or indexed).
+	// Lookups and hits are counted in PredicateStats when COUNT_PREDICATE_STAGES is defined
+	static void getExactLambda(const genericPoint& p, double** lx, int& lxl, double** ly, int& lyl, double** lz, int& lzl, double** d, int& dl);
+
+	// Frees the table of the calling thread
+	static void clear() { Table& t = table(); t.entries.clear(); std::vector<double>().swap(t.data); }
+
+private:
+	static const size_t MAX_ENTRIES = 1 << 16; // per thread, the table is emptied when full
+
+	struct Key {
+		int n;        // number of coordinates (15 for LPI, 27 for TPI)
+		double c[27]; // coordinates of the defining points
+
+		bool operator==(const Key& k) const;
+	};
+
+	struct KeyHash {
+		size_t operator()(const Key& k) const;
+	};
+
+	struct Entry {
+		size_t first; // lx, ly, lz and d one after the other in Table::data
+		int lxl, lyl, lzl, dl;
+	};
+
+	// The lambdas of all the entries share one buffer, so that a miss does not allocate its own
+	struct Table {
+		std::unordered_map<Key, Entry, KeyHash> entries;
+		std::vector<double> data;
+	};
+
+	static Table& table() {
+		static thread_local Table t;
+		return t;
+	}
+
+	static void makeKey(const genericPoint& p, Key& k);
+	static void copyOut(const double* src, int len, double** dst, int& dst_len);
+};
+#endif
+
 //////////////////////////////////////////////////////////////////////////////////////
 //
 // OUTPUT TO STD STREAMS
@@ -484,6 +842,13 @@ inline ostream& operator<<(ostream& os, const implicitPoint3D_LNC& p)
 	else return os << "UNDEF_LNC";
 }
 
+inline ostream& operator<<(ostream& os, const implicitPoint3D_IDX& p)
+{
+	explicitPoint3D e;
+	if (p.apapExplicit(e)) return os << e;
+	else return os << "UNDEF_IDX";
+}
+
 #include "hand_optimized_predicates.hpp"
 #include "implicit_point.hpp"
 
@@ -514,6 +514,194 @@ inline int genericPoint::incirclexy(const genericPoint& a, const genericPoint& b
 }
 
 
+// Interval filters. Explicit coordinates are exact in interval form, so all-explicit tuples use the plain interval filters.
+
+inline int genericPoint::orient2DxyFilter(const genericPoint& a, const genericPoint& b, const genericPoint& c)
+{
+	const explicitPoint3D& ea = a.toExplicit3D(), & eb = b.toExplicit3D(), & ec = c.toExplicit3D();
+
+	if (a.isExplicit3D() && b.isExplicit3D() && c.isExplicit3D()) return orient2d_interval(ea.X(), ea.Y(), eb.X(), eb.Y(), ec.X(), ec.Y());
+
+	if (!a.isExplicit3D() && b.isExplicit3D() && c.isExplicit3D()) return orient2dxy_indirect_IEE_interval(a, eb.X(), eb.Y(), ec.X(), ec.Y());
+	if (a.isExplicit3D() && !b.isExplicit3D() && c.isExplicit3D()) return orient2dxy_indirect_IEE_interval(b, ec.X(), ec.Y(), ea.X(), ea.Y());
+	if (a.isExplicit3D() && b.isExplicit3D() && !c.isExplicit3D()) return orient2dxy_indirect_IEE_interval(c, ea.X(), ea.Y(), eb.X(), eb.Y());
+
+	if (!a.isExplicit3D() && !b.isExplicit3D() && c.isExplicit3D()) return orient2dxy_indirect_IIE_interval(a, b, ec.X(), ec.Y());
+	if (!a.isExplicit3D() && b.isExplicit3D() && !c.isExplicit3D()) return orient2dxy_indirect_IIE_interval(c, a, eb.X(), eb.Y());
+	if (a.isExplicit3D() && !b.isExplicit3D() && !c.isExplicit3D()) return orient2dxy_indirect_IIE_interval(b, c, ea.X(), ea.Y());
+
+	return orient2dxy_indirect_III_interval(a, b, c);
+}
+
+inline int genericPoint::orient2DyzFilter(const genericPoint& a, const genericPoint& b, const genericPoint& c)
+{
+	const explicitPoint3D& ea = a.toExplicit3D(), & eb = b.toExplicit3D(), & ec = c.toExplicit3D();
+
+	if (a.isExplicit3D() && b.isExplicit3D() && c.isExplicit3D()) return orient2d_interval(ea.Y(), ea.Z(), eb.Y(), eb.Z(), ec.Y(), ec.Z());
+
+	if (!a.isExplicit3D() && b.isExplicit3D() && c.isExplicit3D()) return orient2dyz_indirect_IEE_interval(a, eb.Y(), eb.Z(), ec.Y(), ec.Z());
+	if (a.isExplicit3D() && !b.isExplicit3D() && c.isExplicit3D()) return orient2dyz_indirect_IEE_interval(b, ec.Y(), ec.Z(), ea.Y(), ea.Z());
+	if (a.isExplicit3D() && b.isExplicit3D() && !c.isExplicit3D()) return orient2dyz_indirect_IEE_interval(c, ea.Y(), ea.Z(), eb.Y(), eb.Z());
+
+	if (!a.isExplicit3D() && !b.isExplicit3D() && c.isExplicit3D()) return orient2dyz_indirect_IIE_interval(a, b, ec.Y(), ec.Z());
+	if (!a.isExplicit3D() && b.isExplicit3D() && !c.isExplicit3D()) return orient2dyz_indirect_IIE_interval(c, a, eb.Y(), eb.Z());
+	if (a.isExplicit3D() && !b.isExplicit3D() && !c.isExplicit3D()) return orient2dyz_indirect_IIE_interval(b, c, ea.Y(), ea.Z());
+
+	return orient2dyz_indirect_III_interval(a, b, c);
+}
+
+inline int genericPoint::orient2DzxFilter(const genericPoint& a, const genericPoint& b, const genericPoint& c)
+{
+	const explicitPoint3D& ea = a.toExplicit3D(), & eb = b.toExplicit3D(), & ec = c.toExplicit3D();
+
+	if (a.isExplicit3D() && b.isExplicit3D() && c.isExplicit3D()) return orient2d_interval(ea.Z(), ea.X(), eb.Z(), eb.X(), ec.Z(), ec.X());
+
+	if (!a.isExplicit3D() && b.isExplicit3D() && c.isExplicit3D()) return orient2dzx_indirect_IEE_interval(a, eb.Z(), eb.X(), ec.Z(), ec.X());
+	if (a.isExplicit3D() && !b.isExplicit3D() && c.isExplicit3D()) return orient2dzx_indirect_IEE_interval(b, ec.Z(), ec.X(), ea.Z(), ea.X());
+	if (a.isExplicit3D() && b.isExplicit3D() && !c.isExplicit3D()) return orient2dzx_indirect_IEE_interval(c, ea.Z(), ea.X(), eb.Z(), eb.X());
+
+	if (!a.isExplicit3D() && !b.isExplicit3D() && c.isExplicit3D()) return orient2dzx_indirect_IIE_interval(a, b, ec.Z(), ec.X());
+	if (!a.isExplicit3D() && b.isExplicit3D() && !c.isExplicit3D()) return orient2dzx_indirect_IIE_interval(c, a, eb.Z(), eb.X());
+	if (a.isExplicit3D() && !b.isExplicit3D() && !c.isExplicit3D()) return orient2dzx_indirect_IIE_interval(b, c, ea.Z(), ea.X());
+
+	return orient2dzx_indirect_III_interval(a, b, c);
+}
+
+inline int orient3d_IEEE_filter(const genericPoint& a, const genericPoint& b, const genericPoint& c, const genericPoint& d)
+{
+	const explicitPoint3D& eb = b.toExplicit3D(), & ec = c.toExplicit3D(), & ed = d.toExplicit3D();
+	return orient3d_indirect_IEEE_interval(a, eb.X(), eb.Y(), eb.Z(), ec.X(), ec.Y(), ec.Z(), ed.X(), ed.Y(), ed.Z());
+}
+
+inline int orient3d_IIEE_filter(const genericPoint& a, const genericPoint& b, const genericPoint& c, const genericPoint& d)
+{
+	const explicitPoint3D& ec = c.toExplicit3D(), & ed = d.toExplicit3D();
+	return orient3d_indirect_IIEE_interval(a, b, ec.X(), ec.Y(), ec.Z(), ed.X(), ed.Y(), ed.Z());
+}
+
+inline int orient3d_IIIE_filter(const genericPoint& a, const genericPoint& b, const genericPoint& c, const genericPoint& d)
+{
+	const explicitPoint3D& ed = d.toExplicit3D();
+	return orient3d_indirect_IIIE_interval(a, b, c, ed.X(), ed.Y(), ed.Z());
+}
+
+inline int genericPoint::orient3DFilter(const genericPoint& a, const genericPoint& b, const genericPoint& c, const genericPoint& d)
+{
+	const int i = a.isExplicit3D() + b.isExplicit3D() + c.isExplicit3D() + d.isExplicit3D();
+
+	if (i == 4)
+	{
+		const explicitPoint3D& ea = a.toExplicit3D(), & eb = b.toExplicit3D(), & ec = c.toExplicit3D(), & ed = d.toExplicit3D();
+		return orient3d_interval(ea.X(), ea.Y(), ea.Z(), eb.X(), eb.Y(), eb.Z(), ec.X(), ec.Y(), ec.Z(), ed.X(), ed.Y(), ed.Z());
+	}
+
+	if (i == 3)
+	{
+		if (!a.isExplicit3D()) return orient3d_IEEE_filter(a, b, c, d);
+		if (!b.isExplicit3D()) return orient3d_IEEE_filter(b, c, a, d);
+		if (!c.isExplicit3D()) return orient3d_IEEE_filter(c, d, a, b);
+		return orient3d_IEEE_filter(d, a, c, b);
+	}
+
+	if (i == 2)
+	{
+		if (c.isExplicit3D() && d.isExplicit3D()) return orient3d_IIEE_filter(a, b, c, d);
+		if (b.isExplicit3D() && d.isExplicit3D()) return orient3d_IIEE_filter(a, c, d, b);
+		if (a.isExplicit3D() && d.isExplicit3D()) return orient3d_IIEE_filter(b, c, a, d);
+		if (b.isExplicit3D() && c.isExplicit3D()) return orient3d_IIEE_filter(d, a, c, b);
+		if (a.isExplicit3D() && c.isExplicit3D()) return orient3d_IIEE_filter(d, b, a, c);
+		return orient3d_IIEE_filter(c, d, a, b);
+	}
+
+	if (i == 1)
+	{
+		if (d.isExplicit3D()) return orient3d_IIIE_filter(a, b, c, d);
+		if (c.isExplicit3D()) return orient3d_IIIE_filter(d, b, a, c);
+		if (b.isExplicit3D()) return orient3d_IIIE_filter(a, c, d, b);
+		return orient3d_IIIE_filter(b, d, c, a);
+	}
+
+	return orient3d_indirect_IIII_interval(a, b, c, d);
+}
+
+inline int genericPoint::lessThanOnXFilter(const genericPoint& a, const genericPoint& b)
+{
+	if (a.isExplicit3D() && b.isExplicit3D()) return (a.toExplicit3D().X() > b.toExplicit3D().X()) - (a.toExplicit3D().X() < b.toExplicit3D().X());
+	if (!a.isExplicit3D() && b.isExplicit3D()) return lessThanOnX_IE_interval(a, b.toExplicit3D().X());
+	if (a.isExplicit3D() && !b.isExplicit3D()) return -lessThanOnX_IE_interval(b, a.toExplicit3D().X());
+	return lessThanOnX_II_interval(a, b);
+}
+
+inline int genericPoint::lessThanOnYFilter(const genericPoint& a, const genericPoint& b)
+{
+	if (a.isExplicit3D() && b.isExplicit3D()) return (a.toExplicit3D().Y() > b.toExplicit3D().Y()) - (a.toExplicit3D().Y() < b.toExplicit3D().Y());
+	if (!a.isExplicit3D() && b.isExplicit3D()) return lessThanOnY_IE_interval(a, b.toExplicit3D().Y());
+	if (a.isExplicit3D() && !b.isExplicit3D()) return -lessThanOnY_IE_interval(b, a.toExplicit3D().Y());
+	return lessThanOnY_II_interval(a, b);
+}
+
+inline int genericPoint::lessThanOnZFilter(const genericPoint& a, const genericPoint& b)
+{
+	if (a.isExplicit3D() && b.isExplicit3D()) return (a.toExplicit3D().Z() > b.toExplicit3D().Z()) - (a.toExplicit3D().Z() < b.toExplicit3D().Z());
+	if (!a.isExplicit3D() && b.isExplicit3D()) return lessThanOnZ_IE_interval(a, b.toExplicit3D().Z());
+	if (a.isExplicit3D() && !b.isExplicit3D()) return -lessThanOnZ_IE_interval(b, a.toExplicit3D().Z());
+	return lessThanOnZ_II_interval(a, b);
+}
+
+// An uncertain comparison on X may hide equal X coordinates, which require the comparison on Y
+inline int genericPoint::lessThanFilter(const genericPoint& a, const genericPoint& b)
+{
+	if (a.isExplicit3D() && b.isExplicit3D()) return lessThan_EE(a, b);
+	return lessThanOnXFilter(a, b);
+}
+
+// Batched predicates
+
+inline void genericPoint::orient2DxyBatch(const genericPoint* const* a, const genericPoint* const* b, const genericPoint* const* c, int* res, size_t n)
+{
+	{
+		upwardRoundingScope scope;
+		for (size_t i = 0; i < n; i++) res[i] = orient2DxyFilter(*a[i], *b[i], *c[i]);
+	}
+	for (size_t i = 0; i < n; i++) if (res[i] == Filtered_Sign::UNCERTAIN) res[i] = orient2Dxy(*a[i], *b[i], *c[i]);
+}
+
+inline void genericPoint::orient2DyzBatch(const genericPoint* const* a, const genericPoint* const* b, const genericPoint* const* c, int* res, size_t n)
+{
+	{
+		upwardRoundingScope scope;
+		for (size_t i = 0; i < n; i++) res[i] = orient2DyzFilter(*a[i], *b[i], *c[i]);
+	}
+	for (size_t i = 0; i < n; i++) if (res[i] == Filtered_Sign::UNCERTAIN) res[i] = orient2Dyz(*a[i], *b[i], *c[i]);
+}
+
+inline void genericPoint::orient2DzxBatch(const genericPoint* const* a, const genericPoint* const* b, const genericPoint* const* c, int* res, size_t n)
+{
+	{
+		upwardRoundingScope scope;
+		for (size_t i = 0; i < n; i++) res[i] = orient2DzxFilter(*a[i], *b[i], *c[i]);
+	}
+	for (size_t i = 0; i < n; i++) if (res[i] == Filtered_Sign::UNCERTAIN) res[i] = orient2Dzx(*a[i], *b[i], *c[i]);
+}
+
+inline void genericPoint::orient3DBatch(const genericPoint* const* a, const genericPoint* const* b, const genericPoint* const* c, const genericPoint* const* d, int* res, size_t n)
+{
+	{
+		upwardRoundingScope scope;
+		for (size_t i = 0; i < n; i++) res[i] = orient3DFilter(*a[i], *b[i], *c[i], *d[i]);
+	}
+	for (size_t i = 0; i < n; i++) if (res[i] == Filtered_Sign::UNCERTAIN) res[i] = orient3D(*a[i], *b[i], *c[i], *d[i]);
+}
+
+inline void genericPoint::lessThanBatch(const genericPoint* const* a, const genericPoint* const* b, int* res, size_t n)
+{
+	{
+		upwardRoundingScope scope;
+		for (size_t i = 0; i < n; i++) res[i] = lessThanFilter(*a[i], *b[i]);
+	}
+	for (size_t i = 0; i < n; i++) if (res[i] == Filtered_Sign::UNCERTAIN) res[i] = lessThan(*a[i], *b[i]);
+}
+
 // These functions assume that point is an SSI
 inline bool genericPoint::getIntervalLambda(interval_number& lx, interval_number& ly, interval_number& d) const {
 	return toSSI().getIntervalLambda(lx, ly, d);
@@ -531,18 +719,24 @@ inline void genericPoint::getBigfloatLambda(bigfloat& lx, bigfloat& ly, bigfloat
 inline bool genericPoint::getIntervalLambda(interval_number& lx, interval_number& ly, interval_number& lz, interval_number& d) const {
 	if (isLPI()) return toLPI().getIntervalLambda(lx, ly, lz, d);
 	else if (isTPI()) return toTPI().getIntervalLambda(lx, ly, lz, d);
+	else if (isIndexed()) return toIndexed().getIntervalLambda(lx, ly, lz, d);
 	else return toLNC().getIntervalLambda(lx, ly, lz, d);
 }
 
 inline void genericPoint::getExactLambda(double** lx, int& lxl, double** ly, int& lyl, double** lz, int& lzl, double** d, int& dl) const {
+#ifdef CACHE_EXACT_LAMBDAS
+	if (!isLNC()) { exactLambdaCache::getExactLambda(*this, lx, lxl, ly, lyl, lz, lzl, d, dl); return; }
+#endif
 	if (isLPI()) toLPI().getExactLambda(lx, lxl, ly, lyl, lz, lzl, d, dl);
 	else if (isTPI()) toTPI().getExactLambda(lx, lxl, ly, lyl, lz, lzl, d, dl);
+	else if (isIndexed()) toIndexed().getExactLambda(lx, lxl, ly, lyl, lz, lzl, d, dl);
 	else toLNC().getExactLambda(lx, lxl, ly, lyl, lz, lzl, d, dl);
 }
 
 inline void genericPoint::getBigfloatLambda(bigfloat& lx, bigfloat& ly, bigfloat& lz, bigfloat& d) const {
 	if (isLPI()) toLPI().getBigfloatLambda(lx, ly, lz, d);
 	else if (isTPI()) toTPI().getBigfloatLambda(lx, ly, lz, d);
+	else if (isIndexed()) toIndexed().getBigfloatLambda(lx, ly, lz, d);
 	else toLNC().getBigfloatLambda(lx, ly, lz, d);
 }
 
@@ -740,13 +934,282 @@ inline void implicitPoint3D_LNC::getBigfloatLambda(bigfloat& lx, bigfloat& ly, b
 	lambda3d_LNC_bigfloat(P().X(), P().Y(), P().Z(), Q().X(), Q().Y(), Q().Z(), T(), lx, ly, lz, d);
 }
 
+// Indexed points
+
+inline const explicitPoint3D& implicitPoint3D_IDX::ref(int i) const
+{
+	return tab->ref(*this, i);
+}
+
+inline bool implicitPoint3D_IDX::getIntervalLambda(interval_number& lx, interval_number& ly, interval_number& lz, interval_number& d) const
+{
+	return tab->getIntervalLambda(*this, lx, ly, lz, d);
+}
+
+inline void implicitPoint3D_IDX::getExactLambda(double** lx, int& lxl, double** ly, int& lyl, double** lz, int& lzl, double** d, int& dl) const
+{
+	if (isIndexedLPI())
+		lambda3d_LPI_exact(P().X(), P().Y(), P().Z(), Q().X(), Q().Y(), Q().Z(), R().X(), R().Y(), R().Z(), S().X(), S().Y(), S().Z(), T().X(), T().Y(), T().Z(), lx, lxl, ly, lyl, lz, lzl, d, dl);
+	else
+		lambda3d_TPI_exact(V1().X(), V1().Y(), V1().Z(), V2().X(), V2().Y(), V2().Z(), V3().X(), V3().Y(), V3().Z(),
+			W1().X(), W1().Y(), W1().Z(), W2().X(), W2().Y(), W2().Z(), W3().X(), W3().Y(), W3().Z(),
+			U1().X(), U1().Y(), U1().Z(), U2().X(), U2().Y(), U2().Z(), U3().X(), U3().Y(), U3().Z(), lx, lxl, ly, lyl, lz, lzl, d, dl);
+	if ((*d)[dl - 1] < 0)
+	{
+		expansionObject::Gen_Invert(lxl, *lx);
+		expansionObject::Gen_Invert(lyl, *ly);
+		expansionObject::Gen_Invert(lzl, *lz);
+		expansionObject::Gen_Invert(dl, *d);
+	}
+	normalizeLambda3D(*lx, lxl, *ly, lyl, *lz, lzl, *d, dl);
+}
+
+inline void implicitPoint3D_IDX::getBigfloatLambda(bigfloat& lx, bigfloat& ly, bigfloat& lz, bigfloat& d) const
+{
+	if (isIndexedLPI())
+		lambda3d_LPI_bigfloat(P().X(), P().Y(), P().Z(), Q().X(), Q().Y(), Q().Z(), R().X(), R().Y(), R().Z(), S().X(), S().Y(), S().Z(), T().X(), T().Y(), T().Z(), lx, ly, lz, d);
+	else
+		lambda3d_TPI_bigfloat(V1().X(), V1().Y(), V1().Z(), V2().X(), V2().Y(), V2().Z(), V3().X(), V3().Y(), V3().Z(),
+			W1().X(), W1().Y(), W1().Z(), W2().X(), W2().Y(), W2().Z(), W3().X(), W3().Y(), W3().Z(),
+			U1().X(), U1().Y(), U1().Z(), U2().X(), U2().Y(), U2().Z(), U3().X(), U3().Y(), U3().Z(), lx, ly, lz, d);
+	if (sgn(d) < 0)
+	{
+		lx = -lx;
+		ly = -ly;
+		lz = -lz;
+		d = -d;
+	}
+}
+
+inline const char* PredicateStats::familyName(int f)
+{
+	static const char* names[PF_NUM_FAMILIES] = { "orient2d", "orient3d", "lessThan", "incircle", "inSphere", "dotProduct" };
+	return names[f];
+}
+
+inline const char* PredicateStats::stageName(int s)
+{
+	static const char* names[PS_NUM_STAGES] = { "filter", "interval", "exact", "bigfloat" };
+	return names[s];
+}
+
+inline predicateStageCounters::Block& predicateStageCounters::local()
+{
+	static thread_local Block* b = NULL;
+	if (b == NULL)
+	{
+		b = new Block();
+		std::lock_guard<std::mutex> lock(blocks_mutex);
+		blocks.push_back(b);
+	}
+	return *b;
+}
+
+inline PredicateStats predicateStageCounters::collect()
+{
+	PredicateStats st = {};
+#ifdef COUNT_PREDICATE_STAGES
+	st.enabled = true;
+#endif
+	std::lock_guard<std::mutex> lock(blocks_mutex);
+	for (const Block* b : blocks)
+	{
+		for (int f = 0; f < PF_NUM_FAMILIES; f++)
+			for (int s = 0; s < PS_NUM_STAGES; s++) st.reached[f][s] += b->c[f][s].load(std::memory_order_relaxed);
+		st.lambda_lookups += b->lambda_lookups.load(std::memory_order_relaxed);
+		st.lambda_hits += b->lambda_hits.load(std::memory_order_relaxed);
+	}
+	return st;
+}
+
+inline PredicateStats predicateStageCounters::collectSince(const PredicateStats& start)
+{
+	PredicateStats st = collect();
+	for (int f = 0; f < PF_NUM_FAMILIES; f++)
+		for (int s = 0; s < PS_NUM_STAGES; s++) st.reached[f][s] -= start.reached[f][s];
+	st.lambda_lookups -= start.lambda_lookups;
+	st.lambda_hits -= start.lambda_hits;
+	return st;
+}
+
+#ifdef CACHE_EXACT_LAMBDAS
+inline bool exactLambdaCache::Key::operator==(const Key& k) const
+{
+	return (n == k.n && memcmp(c, k.c, n * sizeof(double)) == 0);
+}
+
+inline size_t exactLambdaCache::KeyHash::operator()(const Key& k) const
+{
+	uint64_t h = 14695981039346656037ULL;
+	for (int i = 0; i < k.n; i++)
+	{
+		uint64_t b;
+		memcpy(&b, k.c + i, sizeof(double));
+		h = (h ^ b) * 1099511628211ULL;
+	}
+	return (size_t)(h ^ (h >> 32));
+}
+
+inline void exactLambdaCache::makeKey(const genericPoint& p, Key& k)
+{
+	const explicitPoint3D* r[9];
+	if (p.isLPI())
+	{
+		const implicitPoint3D_LPI& l = p.toLPI();
+		r[0] = &l.P(); r[1] = &l.Q(); r[2] = &l.R(); r[3] = &l.S(); r[4] = &l.T();
+		k.n = 15;
+	}
+	else if (p.isTPI())
+	{
+		const implicitPoint3D_TPI& t = p.toTPI();
+		r[0] = &t.V1(); r[1] = &t.V2(); r[2] = &t.V3(); r[3] = &t.W1(); r[4] = &t.W2(); r[5] = &t.W3(); r[6] = &t.U1(); r[7] = &t.U2(); r[8] = &t.U3();
+		k.n = 27;
+	}
+	else
+	{
+		const implicitPoint3D_IDX& x = p.toIndexed();
+		for (int i = 0; i < x.numRefs(); i++) r[i] = &x.ref(i);
+		k.n = x.numRefs() * 3;
+	}
+
+	for (int i = 0; i < k.n / 3; i++)
+	{
+		k.c[i * 3] = r[i]->X();
+		k.c[i * 3 + 1] = r[i]->Y();
+		k.c[i * 3 + 2] = r[i]->Z();
+	}
+}
+
+inline void exactLambdaCache::copyOut(const double* src, int len, double** dst, int& dst_len)
+{
+	if (len > dst_len) *dst = AllocDoubles(len);
+	memcpy(*dst, src, len * sizeof(double));
+	dst_len = len;
+}
+
+inline void exactLambdaCache::getExactLambda(const genericPoint& p, double** lx, int& lxl, double** ly, int& lyl, double** lz, int& lzl, double** d, int& dl)
+{
+	Key k;
+	makeKey(p, k);
+
+	Table& t = table();
+	auto it = t.entries.find(k);
+	COUNT_LAMBDA_LOOKUP(it != t.entries.end());
+	if (it != t.entries.end())
+	{
+		const Entry& e = it->second;
+		const double* data = t.data.data() + e.first;
+		copyOut(data, e.lxl, lx, lxl);
+		copyOut(data + e.lxl, e.lyl, ly, lyl);
+		copyOut(data + e.lxl + e.lyl, e.lzl, lz, lzl);
+		copyOut(data + e.lxl + e.lyl + e.lzl, e.dl, d, dl);
+		return;
+	}
+
+	if (p.isLPI()) p.toLPI().getExactLambda(lx, lxl, ly, lyl, lz, lzl, d, dl);
+	else if (p.isTPI()) p.toTPI().getExactLambda(lx, lxl, ly, lyl, lz, lzl, d, dl);
+	else p.toIndexed().getExactLambda(lx, lxl, ly, lyl, lz, lzl, d, dl);
+
+	if (t.entries.size() == MAX_ENTRIES) { t.entries.clear(); t.data.clear(); }
+	Entry& e = t.entries[k];
+	e.first = t.data.size();
+	e.lxl = lxl; e.lyl = lyl; e.lzl = lzl; e.dl = dl;
+	t.data.insert(t.data.end(), *lx, *lx + lxl);
+	t.data.insert(t.data.end(), *ly, *ly + lyl);
+	t.data.insert(t.data.end(), *lz, *lz + lzl);
+	t.data.insert(t.data.end(), *d, *d + dl);
+}
+#endif
+
+inline uint32_t implicitPointTable::explicitIndex(const explicitPoint3D& p)
+{
+	if (base != NULL && !base->empty() && &p >= base->data() && &p < base->data() + base->size())
+		return (uint32_t)(&p - base->data());
+
+	auto ins = extra_index.insert({ &p, extra.size });
+	if (!ins.second) return (ins.first->second | EXTRA_BIT);
+	if (extra.size == MAX_EXTRA)
+	{
+		extra_index.erase(ins.first);
+		throw std::length_error("implicitPointTable - too many extra points");
+	}
+	extra.push_back(&p);
+	return ((extra.size - 1) | EXTRA_BIT);
+}
+
+template<int N>
+inline bool implicitPointTable::Store<N>::getIntervalLambda(uint32_t id, interval_number& lx, interval_number& ly, interval_number& lz, interval_number& d) const
+{
+	const Chunk& c = chunk(id);
+	const uint32_t o = offset(id);
+	lx = c.lx[o];
+	ly = c.ly[o];
+	lz = c.lz[o];
+	d = c.d[o];
+	return (d.signIsReliable());
+}
+
+template<int N>
+inline implicitPoint3D_IDX& implicitPointTable::Store<N>::push(const uint32_t* ids, interval_number& lx, interval_number& ly, interval_number& lz, interval_number& d,
+	const Point_Type t, const implicitPointTable* tab)
+{
+	if ((size >> CHUNK_BITS) == chunks.size)
+	{
+		if (chunks.size == MAX_CHUNKS) ip_error("implicitPointTable - too many points\n");
+		chunks.push_back(new Chunk);
+	}
+
+	const uint32_t id = size;
+	Chunk& c = chunk(id);
+	const uint32_t o = offset(id);
+	for (int i = 0; i < N; i++) c.refs[o * N + i] = ids[i];
+	if (d.isNegative()) {
+		lx.negate();
+		ly.negate();
+		lz.negate();
+		d.negate();
+	}
+	c.lx[o] = lx;
+	c.ly[o] = ly;
+	c.lz[o] = lz;
+	c.d[o] = d;
+	c.pts[o] = implicitPoint3D_IDX(t, id, tab);
+	size++;
+	return c.pts[o];
+}
+
+inline implicitPoint3D_IDX& implicitPointTable::addLPI(const explicitPoint3D& p, const explicitPoint3D& q,
+	const explicitPoint3D& r, const explicitPoint3D& s, const explicitPoint3D& t)
+{
+	const uint32_t ids[5] = { explicitIndex(p), explicitIndex(q), explicitIndex(r), explicitIndex(s), explicitIndex(t) };
+	interval_number lx, ly, lz, d;
+	lambda3d_LPI_interval(p.X(), p.Y(), p.Z(), q.X(), q.Y(), q.Z(), r.X(), r.Y(), r.Z(), s.X(), s.Y(), s.Z(), t.X(), t.Y(), t.Z(), lx, ly, lz, d);
+	return lpi.push(ids, lx, ly, lz, d, Point_Type::LPI_IDX, this);
+}
+
+inline implicitPoint3D_IDX& implicitPointTable::addTPI(const explicitPoint3D& v1, const explicitPoint3D& v2, const explicitPoint3D& v3,
+	const explicitPoint3D& w1, const explicitPoint3D& w2, const explicitPoint3D& w3,
+	const explicitPoint3D& u1, const explicitPoint3D& u2, const explicitPoint3D& u3)
+{
+	const uint32_t ids[9] = { explicitIndex(v1), explicitIndex(v2), explicitIndex(v3),
+		explicitIndex(w1), explicitIndex(w2), explicitIndex(w3),
+		explicitIndex(u1), explicitIndex(u2), explicitIndex(u3) };
+	interval_number lx, ly, lz, d;
+	lambda3d_TPI_interval(
+		v1.X(), v1.Y(), v1.Z(), v2.X(), v2.Y(), v2.Z(), v3.X(), v3.Y(), v3.Z(),
+		w1.X(), w1.Y(), w1.Z(), w2.X(), w2.Y(), w2.Z(), w3.X(), w3.Y(), w3.Z(),
+		u1.X(), u1.Y(), u1.Z(), u2.X(), u2.Y(), u2.Z(), u3.X(), u3.Y(), u3.Z(),
+		lx, ly, lz, d);
+	return tpi.push(ids, lx, ly, lz, d, Point_Type::TPI_IDX, this);
+}
+
 
 inline bool genericPoint::apapExplicit(explicitPoint2D& e) const
 {
 	if (isExplicit2D()) e = toExplicit2D();
 	else {
 		double l1x_p[128], * l1x = l1x_p, l1y_p[128], * l1y = l1y_p, d1_p[128], * d1 = d1_p;
-		int l1x_len, l1y_len, d1_len;
+		int l1x_len = 128, l1y_len = 128, d1_len = 128;
 		getExactLambda(&l1x, l1x_len, &l1y, l1y_len, &d1, d1_len);
 		const double lambda_x = expansionObject::To_Double(l1x_len, l1x);
 		const double lambda_y = expansionObject::To_Double(l1y_len, l1y);
@@ -784,7 +1247,7 @@ inline bool genericPoint::apapExplicit(explicitPoint3D& e) const
 	if (isExplicit3D()) e = toExplicit3D();
 	else {
 		double l1z_p[128], * l1z = l1z_p, l1x_p[128], * l1x = l1x_p, l1y_p[128], * l1y = l1y_p, d1_p[128], * d1 = d1_p;
-		int l1z_len, l1x_len, l1y_len, d1_len;
+		int l1z_len = 128, l1x_len = 128, l1y_len = 128, d1_len = 128;
 		getExactLambda(&l1x, l1x_len, &l1y, l1y_len, &l1z, l1z_len, &d1, d1_len);
 		const double lambda_x = expansionObject::To_Double(l1x_len, l1x);
 		const double lambda_y = expansionObject::To_Double(l1y_len, l1y);
@@ -871,6 +1334,7 @@ inline bool genericPoint::getExactXYZCoordinates(bigrational& x, bigrational& y,
 	else if (isLPI()) return toLPI().getExactXYZCoordinates(x, y, z);
 	else if (isTPI()) return toTPI().getExactXYZCoordinates(x, y, z);
 	else if (isLNC()) return toLNC().getExactXYZCoordinates(x, y, z);
+	else if (isIndexed()) return toIndexed().getExactXYZCoordinates(x, y, z);
 	else if (isExplicit2D()) { z = bigfloat(0); return toExplicit2D().getExactXYCoordinates(x, y); }
 	else if (isSSI()) { z = bigfloat(0); return toSSI().getExactXYCoordinates(x, y); }
 	else ip_error("genericPoint::getExactXYZCoordinates - should not happen\n");
@@ -912,6 +1376,18 @@ inline bool implicitPoint3D_TPI::getExactXYZCoordinates(bigrational& x, bigratio
 	return true;
 }
 
+inline bool implicitPoint3D_IDX::getExactXYZCoordinates(bigrational& x, bigrational& y, bigrational& z) const
+{
+	bigfloat lx, ly, lz, d;
+	getBigfloatLambda(lx, ly, lz, d);
+	if (sgn(d) == 0) return false;
+	const bigrational rd(d);
+	x = bigrational(lx) / rd;
+	y = bigrational(ly) / rd;
+	z = bigrational(lz) / rd;
+	return true;
+}
+
 inline bool implicitPoint3D_LNC::getExactXYZCoordinates(bigrational& x, bigrational& y, bigrational& z) const
 {
 	bigfloat lx, ly, lz, d;
@@ -930,6 +1406,7 @@ inline ostream& operator<<(ostream& os, const genericPoint& p)
 	else if (p.isLPI()) return os << p.toLPI();
 	else if (p.isTPI()) return os << p.toTPI();
 	else if (p.isLNC()) return os << p.toLNC();
+	else if (p.isIndexed()) return os << p.toIndexed();
 	else ip_error("genericPoint::operator<< - should not happen\n");
 	return os;
 }
@@ -37,6 +37,7 @@
 
 inline int dotProductSign2D_filtered(double px, double py, double rx, double ry, double qx, double qy)
 {
+   COUNT_PREDICATE_STAGE(PF_DOTPRODUCT, PS_FILTER);
    const double lx = px - qx;
    const double ly = py - qy;
    const double gx = rx - qx;
@@ -62,6 +63,7 @@ inline int dotProductSign2D_filtered(double px, double py, double rx, double ry,
 
 inline int dotProductSign2D_interval(interval_number px, interval_number py, interval_number rx, interval_number ry, interval_number qx, interval_number qy)
 {
+   COUNT_PREDICATE_STAGE(PF_DOTPRODUCT, PS_INTERVAL);
    setFPUModeToRoundUP();
    const interval_number lx(px - qx);
    const interval_number ly(py - qy);
@@ -78,6 +80,7 @@ inline int dotProductSign2D_interval(interval_number px, interval_number py, int
 
 inline int dotProductSign2D_bigfloat(bigfloat px, bigfloat py, bigfloat rx, bigfloat ry, bigfloat qx, bigfloat qy)
 {
+   COUNT_PREDICATE_STAGE(PF_DOTPRODUCT, PS_BIGFLOAT);
    const bigfloat lx(px - qx);
    const bigfloat ly(py - qy);
    const bigfloat gx(rx - qx);
@@ -90,6 +93,7 @@ inline int dotProductSign2D_bigfloat(bigfloat px, bigfloat py, bigfloat rx, bigf
 
 inline int dotProductSign2D_exact(double px, double py, double rx, double ry, double qx, double qy)
 {
+   COUNT_PREDICATE_STAGE(PF_DOTPRODUCT, PS_EXACT);
    
    double lx[2];
    expansionObject::two_Diff(px, qx, lx);
@@ -126,6 +130,7 @@ inline int dotProductSign2D(double px, double py, double rx, double ry, double q
 
 inline int dotProductSign3D_filtered(double px, double py, double pz, double rx, double ry, double rz, double qx, double qy, double qz)
 {
+   COUNT_PREDICATE_STAGE(PF_DOTPRODUCT, PS_FILTER);
    const double lx = px - qx;
    const double ly = py - qy;
    const double lz = pz - qz;
@@ -157,6 +162,7 @@ inline int dotProductSign3D_filtered(double px, double py, double pz, double rx,
 
 inline int dotProductSign3D_interval(interval_number px, interval_number py, interval_number pz, interval_number rx, interval_number ry, interval_number rz, interval_number qx, interval_number qy, interval_number qz)
 {
+   COUNT_PREDICATE_STAGE(PF_DOTPRODUCT, PS_INTERVAL);
    setFPUModeToRoundUP();
    const interval_number lx(px - qx);
    const interval_number ly(py - qy);
@@ -177,6 +183,7 @@ inline int dotProductSign3D_interval(interval_number px, interval_number py, int
 
 inline int dotProductSign3D_bigfloat(bigfloat px, bigfloat py, bigfloat pz, bigfloat rx, bigfloat ry, bigfloat rz, bigfloat qx, bigfloat qy, bigfloat qz)
 {
+   COUNT_PREDICATE_STAGE(PF_DOTPRODUCT, PS_BIGFLOAT);
    const bigfloat lx(px - qx);
    const bigfloat ly(py - qy);
    const bigfloat lz(pz - qz);
@@ -193,6 +200,7 @@ inline int dotProductSign3D_bigfloat(bigfloat px, bigfloat py, bigfloat pz, bigf
 
 inline int dotProductSign3D_exact(double px, double py, double pz, double rx, double ry, double rz, double qx, double qy, double qz)
 {
+   COUNT_PREDICATE_STAGE(PF_DOTPRODUCT, PS_EXACT);
    
    double lx[2];
    expansionObject::two_Diff(px, qx, lx);
@@ -237,6 +245,7 @@ inline int dotProductSign3D(double px, double py, double pz, double rx, double r
 
 inline int incircle_filtered(double pax, double pay, double pbx, double pby, double pcx, double pcy, double pdx, double pdy)
 {
+   COUNT_PREDICATE_STAGE(PF_INCIRCLE, PS_FILTER);
    const double adx = pax - pdx;
    const double ady = pay - pdy;
    const double bdx = pbx - pdx;
@@ -287,6 +296,7 @@ inline int incircle_filtered(double pax, double pay, double pbx, double pby, dou
 
 inline int incircle_interval(interval_number pax, interval_number pay, interval_number pbx, interval_number pby, interval_number pcx, interval_number pcy, interval_number pdx, interval_number pdy)
 {
+   COUNT_PREDICATE_STAGE(PF_INCIRCLE, PS_INTERVAL);
    setFPUModeToRoundUP();
    const interval_number adx(pax - pdx);
    const interval_number ady(pay - pdy);
@@ -325,6 +335,7 @@ inline int incircle_interval(interval_number pax, interval_number pay, interval_
 
 inline int incircle_bigfloat(bigfloat pax, bigfloat pay, bigfloat pbx, bigfloat pby, bigfloat pcx, bigfloat pcy, bigfloat pdx, bigfloat pdy)
 {
+   COUNT_PREDICATE_STAGE(PF_INCIRCLE, PS_BIGFLOAT);
    const bigfloat adx(pax - pdx);
    const bigfloat ady(pay - pdy);
    const bigfloat bdx(pbx - pdx);
@@ -359,6 +370,7 @@ inline int incircle_bigfloat(bigfloat pax, bigfloat pay, bigfloat pbx, bigfloat
 
 inline int incircle_exact(double pax, double pay, double pbx, double pby, double pcx, double pcy, double pdx, double pdy)
 {
+   COUNT_PREDICATE_STAGE(PF_INCIRCLE, PS_EXACT);
    
    double adx[2];
    expansionObject::two_Diff(pax, pdx, adx);
@@ -444,6 +456,7 @@ inline int incircle(double pax, double pay, double pbx, double pby, double pcx,
 
 inline int inSphere_filtered(double pax, double pay, double paz, double pbx, double pby, double pbz, double pcx, double pcy, double pcz, double pdx, double pdy, double pdz, double pex, double pey, double pez)
 {
+   COUNT_PREDICATE_STAGE(PF_INSPHERE, PS_FILTER);
    const double aex = pax - pex;
    const double aey = pay - pey;
    const double aez = paz - pez;
@@ -549,6 +562,7 @@ inline int inSphere_filtered(double pax, double pay, double paz, double pbx, dou
 
 inline int inSphere_interval(interval_number pax, interval_number pay, interval_number paz, interval_number pbx, interval_number pby, interval_number pbz, interval_number pcx, interval_number pcy, interval_number pcz, interval_number pdx, interval_number pdy, interval_number pdz, interval_number pex, interval_number pey, interval_number pez)
 {
+   COUNT_PREDICATE_STAGE(PF_INSPHERE, PS_INTERVAL);
    setFPUModeToRoundUP();
    const interval_number aex(pax - pex);
    const interval_number aey(pay - pey);
@@ -635,6 +649,7 @@ inline int inSphere_interval(interval_number pax, interval_number pay, interval_
 
 inline int inSphere_bigfloat(bigfloat pax, bigfloat pay, bigfloat paz, bigfloat pbx, bigfloat pby, bigfloat pbz, bigfloat pcx, bigfloat pcy, bigfloat pcz, bigfloat pdx, bigfloat pdy, bigfloat pdz, bigfloat pex, bigfloat pey, bigfloat pez)
 {
+   COUNT_PREDICATE_STAGE(PF_INSPHERE, PS_BIGFLOAT);
    const bigfloat aex(pax - pex);
    const bigfloat aey(pay - pey);
    const bigfloat aez(paz - pez);
@@ -717,6 +732,7 @@ inline int inSphere_bigfloat(bigfloat pax, bigfloat pay, bigfloat paz, bigfloat
 
 inline int inSphere_exact(double pax, double pay, double paz, double pbx, double pby, double pbz, double pcx, double pcy, double pcz, double pdx, double pdy, double pdz, double pex, double pey, double pez)
 {
+   COUNT_PREDICATE_STAGE(PF_INSPHERE, PS_EXACT);
    
    double aex[2];
    expansionObject::two_Diff(pax, pex, aex);
@@ -920,6 +936,7 @@ inline int inSphere(double pax, double pay, double paz, double pbx, double pby,
 
 inline int dotProductSign2D_EEI_interval(const genericPoint& q, interval_number px, interval_number py, interval_number rx, interval_number ry)
 {
+   COUNT_PREDICATE_STAGE(PF_DOTPRODUCT, PS_INTERVAL);
    interval_number lqx, lqy, dq;
    if (
    !q.getIntervalLambda(lqx, lqy, dq)
@@ -945,6 +962,7 @@ inline int dotProductSign2D_EEI_interval(const genericPoint& q, interval_number
 
 inline int dotProductSign2D_EEI_bigfloat(const genericPoint& q, bigfloat px, bigfloat py, bigfloat rx, bigfloat ry)
 {
+   COUNT_PREDICATE_STAGE(PF_DOTPRODUCT, PS_BIGFLOAT);
    bigfloat lqx, lqy, dq;
    q.getBigfloatLambda(lqx, lqy, dq);
    const bigfloat pxq(px * dq);
@@ -963,6 +981,7 @@ inline int dotProductSign2D_EEI_bigfloat(const genericPoint& q, bigfloat px, big
 
 inline int dotProductSign2D_EEI_exact(const genericPoint& q, double px, double py, double rx, double ry)
 {
+   COUNT_PREDICATE_STAGE(PF_DOTPRODUCT, PS_EXACT);
  double return_value = NAN;
 #ifdef CHECK_FOR_XYZERFLOWS
    feclearexcept(FE_ALL_EXCEPT);
@@ -1031,6 +1050,7 @@ inline int dotProductSign2D_EEI(const genericPoint& q, double px, double py, dou
 
 inline int dotProductSign2D_IEE_interval(const genericPoint& p, interval_number rx, interval_number ry, interval_number qx, interval_number qy)
 {
+   COUNT_PREDICATE_STAGE(PF_DOTPRODUCT, PS_INTERVAL);
    interval_number lpx, lpy, dp;
    if (
    !p.getIntervalLambda(lpx, lpy, dp)
@@ -1054,6 +1074,7 @@ inline int dotProductSign2D_IEE_interval(const genericPoint& p, interval_number
 
 inline int dotProductSign2D_IEE_bigfloat(const genericPoint& p, bigfloat rx, bigfloat ry, bigfloat qx, bigfloat qy)
 {
+   COUNT_PREDICATE_STAGE(PF_DOTPRODUCT, PS_BIGFLOAT);
    bigfloat lpx, lpy, dp;
    p.getBigfloatLambda(lpx, lpy, dp);
    const bigfloat qxd(qx * dp);
@@ -1070,6 +1091,7 @@ inline int dotProductSign2D_IEE_bigfloat(const genericPoint& p, bigfloat rx, big
 
 inline int dotProductSign2D_IEE_exact(const genericPoint& p, double rx, double ry, double qx, double qy)
 {
+   COUNT_PREDICATE_STAGE(PF_DOTPRODUCT, PS_EXACT);
  double return_value = NAN;
 #ifdef CHECK_FOR_XYZERFLOWS
    feclearexcept(FE_ALL_EXCEPT);
@@ -1130,6 +1152,7 @@ inline int dotProductSign2D_IEE(const genericPoint& p, double rx, double ry, dou
 
 inline int dotProductSign2D_IEI_interval(const genericPoint& p, const genericPoint& q, interval_number rx, interval_number ry)
 {
+   COUNT_PREDICATE_STAGE(PF_DOTPRODUCT, PS_INTERVAL);
    interval_number lpx, lpy, dp, lqx, lqy, dq;
    if (
    !p.getIntervalLambda(lpx, lpy, dp)
@@ -1159,6 +1182,7 @@ inline int dotProductSign2D_IEI_interval(const genericPoint& p, const genericPoi
 
 inline int dotProductSign2D_IEI_bigfloat(const genericPoint& p, const genericPoint& q, bigfloat rx, bigfloat ry)
 {
+   COUNT_PREDICATE_STAGE(PF_DOTPRODUCT, PS_BIGFLOAT);
    bigfloat lpx, lpy, dp, lqx, lqy, dq;
    p.getBigfloatLambda(lpx, lpy, dp);
    q.getBigfloatLambda(lqx, lqy, dq);
@@ -1181,6 +1205,7 @@ inline int dotProductSign2D_IEI_bigfloat(const genericPoint& p, const genericPoi
 
 inline int dotProductSign2D_IEI_exact(const genericPoint& p, const genericPoint& q, double rx, double ry)
 {
+   COUNT_PREDICATE_STAGE(PF_DOTPRODUCT, PS_EXACT);
  double return_value = NAN;
 #ifdef CHECK_FOR_XYZERFLOWS
    feclearexcept(FE_ALL_EXCEPT);
@@ -1265,6 +1290,7 @@ inline int dotProductSign2D_IEI(const genericPoint& p, const genericPoint& q, do
 
 inline int dotProductSign2D_IIE_interval(const genericPoint& p, const genericPoint& r, interval_number qx, interval_number qy)
 {
+   COUNT_PREDICATE_STAGE(PF_DOTPRODUCT, PS_INTERVAL);
    interval_number lpx, lpy, dp, lrx, lry, dr;
    if (
    !p.getIntervalLambda(lpx, lpy, dp)
@@ -1291,6 +1317,7 @@ inline int dotProductSign2D_IIE_interval(const genericPoint& p, const genericPoi
 
 inline int dotProductSign2D_IIE_bigfloat(const genericPoint& p, const genericPoint& r, bigfloat qx, bigfloat qy)
 {
+   COUNT_PREDICATE_STAGE(PF_DOTPRODUCT, PS_BIGFLOAT);
    bigfloat lpx, lpy, dp, lrx, lry, dr;
    p.getBigfloatLambda(lpx, lpy, dp);
    r.getBigfloatLambda(lrx, lry, dr);
@@ -1310,6 +1337,7 @@ inline int dotProductSign2D_IIE_bigfloat(const genericPoint& p, const genericPoi
 
 inline int dotProductSign2D_IIE_exact(const genericPoint& p, const genericPoint& r, double qx, double qy)
 {
+   COUNT_PREDICATE_STAGE(PF_DOTPRODUCT, PS_EXACT);
  double return_value = NAN;
 #ifdef CHECK_FOR_XYZERFLOWS
    feclearexcept(FE_ALL_EXCEPT);
@@ -1385,6 +1413,7 @@ inline int dotProductSign2D_IIE(const genericPoint& p, const genericPoint& r, do
 
 inline int dotProductSign2D_III_interval(const genericPoint& p, const genericPoint& r, const genericPoint& q)
 {
+   COUNT_PREDICATE_STAGE(PF_DOTPRODUCT, PS_INTERVAL);
    interval_number lpx, lpy, dp, lrx, lry, dr, lqx, lqy, dq;
    if (
    !p.getIntervalLambda(lpx, lpy, dp)
@@ -1416,6 +1445,7 @@ inline int dotProductSign2D_III_interval(const genericPoint& p, const genericPoi
 
 inline int dotProductSign2D_III_bigfloat(const genericPoint& p, const genericPoint& r, const genericPoint& q)
 {
+   COUNT_PREDICATE_STAGE(PF_DOTPRODUCT, PS_BIGFLOAT);
    bigfloat lpx, lpy, dp, lrx, lry, dr, lqx, lqy, dq;
    p.getBigfloatLambda(lpx, lpy, dp);
    r.getBigfloatLambda(lrx, lry, dr);
@@ -1440,6 +1470,7 @@ inline int dotProductSign2D_III_bigfloat(const genericPoint& p, const genericPoi
 
 inline int dotProductSign2D_III_exact(const genericPoint& p, const genericPoint& r, const genericPoint& q)
 {
+   COUNT_PREDICATE_STAGE(PF_DOTPRODUCT, PS_EXACT);
  double return_value = NAN;
 #ifdef CHECK_FOR_XYZERFLOWS
    feclearexcept(FE_ALL_EXCEPT);
@@ -1531,6 +1562,7 @@ inline int dotProductSign2D_III(const genericPoint& p, const genericPoint& r, co
 
 inline int dotProductSign3D_EEI_interval(const genericPoint& q, interval_number px, interval_number py, interval_number pz, interval_number rx, interval_number ry, interval_number rz)
 {
+   COUNT_PREDICATE_STAGE(PF_DOTPRODUCT, PS_INTERVAL);
    interval_number lqx, lqy, lqz, dq;
    if (
    !q.getIntervalLambda(lqx, lqy, lqz, dq)
@@ -1562,6 +1594,7 @@ inline int dotProductSign3D_EEI_interval(const genericPoint& q, interval_number
 
 inline int dotProductSign3D_EEI_bigfloat(const genericPoint& q, bigfloat px, bigfloat py, bigfloat pz, bigfloat rx, bigfloat ry, bigfloat rz)
 {
+   COUNT_PREDICATE_STAGE(PF_DOTPRODUCT, PS_BIGFLOAT);
    bigfloat lqx, lqy, lqz, dq;
    q.getBigfloatLambda(lqx, lqy, lqz, dq);
    const bigfloat pxq(px * dq);
@@ -1586,6 +1619,7 @@ inline int dotProductSign3D_EEI_bigfloat(const genericPoint& q, bigfloat px, big
 
 inline int dotProductSign3D_EEI_exact(const genericPoint& q, double px, double py, double pz, double rx, double ry, double rz)
 {
+   COUNT_PREDICATE_STAGE(PF_DOTPRODUCT, PS_EXACT);
  double return_value = NAN;
 #ifdef CHECK_FOR_XYZERFLOWS
    feclearexcept(FE_ALL_EXCEPT);
@@ -1676,6 +1710,7 @@ inline int dotProductSign3D_EEI(const genericPoint& q, double px, double py, dou
 
 inline int dotProductSign3D_IEE_interval(const genericPoint& p, interval_number rx, interval_number ry, interval_number rz, interval_number qx, interval_number qy, interval_number qz)
 {
+   COUNT_PREDICATE_STAGE(PF_DOTPRODUCT, PS_INTERVAL);
    interval_number lpx, lpy, lpz, dp;
    if (
    !p.getIntervalLambda(lpx, lpy, lpz, dp)
@@ -1704,6 +1739,7 @@ inline int dotProductSign3D_IEE_interval(const genericPoint& p, interval_number
 
 inline int dotProductSign3D_IEE_bigfloat(const genericPoint& p, bigfloat rx, bigfloat ry, bigfloat rz, bigfloat qx, bigfloat qy, bigfloat qz)
 {
+   COUNT_PREDICATE_STAGE(PF_DOTPRODUCT, PS_BIGFLOAT);
    bigfloat lpx, lpy, lpz, dp;
    p.getBigfloatLambda(lpx, lpy, lpz, dp);
    const bigfloat qxd(qx * dp);
@@ -1725,6 +1761,7 @@ inline int dotProductSign3D_IEE_bigfloat(const genericPoint& p, bigfloat rx, big
 
 inline int dotProductSign3D_IEE_exact(const genericPoint& p, double rx, double ry, double rz, double qx, double qy, double qz)
 {
+   COUNT_PREDICATE_STAGE(PF_DOTPRODUCT, PS_EXACT);
  double return_value = NAN;
 #ifdef CHECK_FOR_XYZERFLOWS
    feclearexcept(FE_ALL_EXCEPT);
@@ -1799,6 +1836,7 @@ inline int dotProductSign3D_IEE(const genericPoint& p, double rx, double ry, dou
 
 inline int dotProductSign3D_IEI_interval(const genericPoint& p, const genericPoint& q, interval_number rx, interval_number ry, interval_number rz)
 {
+   COUNT_PREDICATE_STAGE(PF_DOTPRODUCT, PS_INTERVAL);
    interval_number lpx, lpy, lpz, dp, lqx, lqy, lqz, dq;
    if (
    !p.getIntervalLambda(lpx, lpy, lpz, dp)
@@ -1835,6 +1873,7 @@ inline int dotProductSign3D_IEI_interval(const genericPoint& p, const genericPoi
 
 inline int dotProductSign3D_IEI_bigfloat(const genericPoint& p, const genericPoint& q, bigfloat rx, bigfloat ry, bigfloat rz)
 {
+   COUNT_PREDICATE_STAGE(PF_DOTPRODUCT, PS_BIGFLOAT);
    bigfloat lpx, lpy, lpz, dp, lqx, lqy, lqz, dq;
    p.getBigfloatLambda(lpx, lpy, lpz, dp);
    q.getBigfloatLambda(lqx, lqy, lqz, dq);
@@ -1864,6 +1903,7 @@ inline int dotProductSign3D_IEI_bigfloat(const genericPoint& p, const genericPoi
 
 inline int dotProductSign3D_IEI_exact(const genericPoint& p, const genericPoint& q, double rx, double ry, double rz)
 {
+   COUNT_PREDICATE_STAGE(PF_DOTPRODUCT, PS_EXACT);
  double return_value = NAN;
 #ifdef CHECK_FOR_XYZERFLOWS
    feclearexcept(FE_ALL_EXCEPT);
@@ -1971,6 +2011,7 @@ inline int dotProductSign3D_IEI(const genericPoint& p, const genericPoint& q, do
 
 inline int dotProductSign3D_IIE_interval(const genericPoint& p, const genericPoint& r, interval_number qx, interval_number qy, interval_number qz)
 {
+   COUNT_PREDICATE_STAGE(PF_DOTPRODUCT, PS_INTERVAL);
    interval_number lpx, lpy, lpz, dp, lrx, lry, lrz, dr;
    if (
    !p.getIntervalLambda(lpx, lpy, lpz, dp)
@@ -2003,6 +2044,7 @@ inline int dotProductSign3D_IIE_interval(const genericPoint& p, const genericPoi
 
 inline int dotProductSign3D_IIE_bigfloat(const genericPoint& p, const genericPoint& r, bigfloat qx, bigfloat qy, bigfloat qz)
 {
+   COUNT_PREDICATE_STAGE(PF_DOTPRODUCT, PS_BIGFLOAT);
    bigfloat lpx, lpy, lpz, dp, lrx, lry, lrz, dr;
    p.getBigfloatLambda(lpx, lpy, lpz, dp);
    r.getBigfloatLambda(lrx, lry, lrz, dr);
@@ -2028,6 +2070,7 @@ inline int dotProductSign3D_IIE_bigfloat(const genericPoint& p, const genericPoi
 
 inline int dotProductSign3D_IIE_exact(const genericPoint& p, const genericPoint& r, double qx, double qy, double qz)
 {
+   COUNT_PREDICATE_STAGE(PF_DOTPRODUCT, PS_EXACT);
  double return_value = NAN;
 #ifdef CHECK_FOR_XYZERFLOWS
    feclearexcept(FE_ALL_EXCEPT);
@@ -2123,6 +2166,7 @@ inline int dotProductSign3D_IIE(const genericPoint& p, const genericPoint& r, do
 
 inline int dotProductSign3D_III_interval(const genericPoint& p, const genericPoint& r, const genericPoint& q)
 {
+   COUNT_PREDICATE_STAGE(PF_DOTPRODUCT, PS_INTERVAL);
    interval_number lpx, lpy, lpz, dp, lrx, lry, lrz, dr, lqx, lqy, lqz, dq;
    if (
    !p.getIntervalLambda(lpx, lpy, lpz, dp)
@@ -2162,6 +2206,7 @@ inline int dotProductSign3D_III_interval(const genericPoint& p, const genericPoi
 
 inline int dotProductSign3D_III_bigfloat(const genericPoint& p, const genericPoint& r, const genericPoint& q)
 {
+   COUNT_PREDICATE_STAGE(PF_DOTPRODUCT, PS_BIGFLOAT);
    bigfloat lpx, lpy, lpz, dp, lrx, lry, lrz, dr, lqx, lqy, lqz, dq;
    p.getBigfloatLambda(lpx, lpy, lpz, dp);
    r.getBigfloatLambda(lrx, lry, lrz, dr);
@@ -2194,6 +2239,7 @@ inline int dotProductSign3D_III_bigfloat(const genericPoint& p, const genericPoi
 
 inline int dotProductSign3D_III_exact(const genericPoint& p, const genericPoint& r, const genericPoint& q)
 {
+   COUNT_PREDICATE_STAGE(PF_DOTPRODUCT, PS_EXACT);
  double return_value = NAN;
 #ifdef CHECK_FOR_XYZERFLOWS
    feclearexcept(FE_ALL_EXCEPT);
@@ -2312,6 +2358,7 @@ inline int dotProductSign3D_III(const genericPoint& p, const genericPoint& r, co
 
 inline int incirclexy_indirect_IEEE_interval(const genericPoint& p1, interval_number pbx, interval_number pby, interval_number pcx, interval_number pcy, interval_number pdx, interval_number pdy)
 {
+   COUNT_PREDICATE_STAGE(PF_INCIRCLE, PS_INTERVAL);
    interval_number l1x, l1y, l1z, d1;
    if (
    !p1.getIntervalLambda(l1x, l1y, l1z, d1)
@@ -2359,6 +2406,7 @@ inline int incirclexy_indirect_IEEE_interval(const genericPoint& p1, interval_nu
 
 inline int incirclexy_indirect_IEEE_bigfloat(const genericPoint& p1, bigfloat pbx, bigfloat pby, bigfloat pcx, bigfloat pcy, bigfloat pdx, bigfloat pdy)
 {
+   COUNT_PREDICATE_STAGE(PF_INCIRCLE, PS_BIGFLOAT);
    bigfloat l1x, l1y, l1z, d1;
    p1.getBigfloatLambda(l1x, l1y, l1z, d1);
    const bigfloat pdxt(pdx * d1);
@@ -2399,6 +2447,7 @@ inline int incirclexy_indirect_IEEE_bigfloat(const genericPoint& p1, bigfloat pb
 
 inline int incirclexy_indirect_IEEE_exact(const genericPoint& p1, double pbx, double pby, double pcx, double pcy, double pdx, double pdy)
 {
+   COUNT_PREDICATE_STAGE(PF_INCIRCLE, PS_EXACT);
  double return_value = NAN;
 #ifdef CHECK_FOR_XYZERFLOWS
    feclearexcept(FE_ALL_EXCEPT);
@@ -2524,6 +2573,7 @@ inline int incirclexy_indirect_IEEE(const genericPoint& p1, double pbx, double p
 
 inline int incirclexy_indirect_IIEE_interval(const genericPoint& p1, const genericPoint& p2, interval_number pcx, interval_number pcy, interval_number pdx, interval_number pdy)
 {
+   COUNT_PREDICATE_STAGE(PF_INCIRCLE, PS_INTERVAL);
    interval_number l1x, l1y, l1z, d1, l2x, l2y, l2z, d2;
    if (
    !p1.getIntervalLambda(l1x, l1y, l1z, d1)
@@ -2575,6 +2625,7 @@ inline int incirclexy_indirect_IIEE_interval(const genericPoint& p1, const gener
 
 inline int incirclexy_indirect_IIEE_bigfloat(const genericPoint& p1, const genericPoint& p2, bigfloat pcx, bigfloat pcy, bigfloat pdx, bigfloat pdy)
 {
+   COUNT_PREDICATE_STAGE(PF_INCIRCLE, PS_BIGFLOAT);
    bigfloat l1x, l1y, l1z, d1, l2x, l2y, l2z, d2;
    p1.getBigfloatLambda(l1x, l1y, l1z, d1);
    p2.getBigfloatLambda(l2x, l2y, l2z, d2);
@@ -2619,6 +2670,7 @@ inline int incirclexy_indirect_IIEE_bigfloat(const genericPoint& p1, const gener
 
 inline int incirclexy_indirect_IIEE_exact(const genericPoint& p1, const genericPoint& p2, double pcx, double pcy, double pdx, double pdy)
 {
+   COUNT_PREDICATE_STAGE(PF_INCIRCLE, PS_EXACT);
  double return_value = NAN;
 #ifdef CHECK_FOR_XYZERFLOWS
    feclearexcept(FE_ALL_EXCEPT);
@@ -2766,6 +2818,7 @@ inline int incirclexy_indirect_IIEE(const genericPoint& p1, const genericPoint&
 
 inline int incirclexy_indirect_IIIE_interval(const genericPoint& p1, const genericPoint& p2, const genericPoint& p3, interval_number pdx, interval_number pdy)
 {
+   COUNT_PREDICATE_STAGE(PF_INCIRCLE, PS_INTERVAL);
    interval_number l1x, l1y, l1z, d1, l2x, l2y, l2z, d2, l3x, l3y, l3z, d3;
    if (
    !p1.getIntervalLambda(l1x, l1y, l1z, d1)
@@ -2822,6 +2875,7 @@ inline int incirclexy_indirect_IIIE_interval(const genericPoint& p1, const gener
 
 inline int incirclexy_indirect_IIIE_bigfloat(const genericPoint& p1, const genericPoint& p2, const genericPoint& p3, bigfloat pdx, bigfloat pdy)
 {
+   COUNT_PREDICATE_STAGE(PF_INCIRCLE, PS_BIGFLOAT);
    bigfloat l1x, l1y, l1z, d1, l2x, l2y, l2z, d2, l3x, l3y, l3z, d3;
    p1.getBigfloatLambda(l1x, l1y, l1z, d1);
    p2.getBigfloatLambda(l2x, l2y, l2z, d2);
@@ -2871,6 +2925,7 @@ inline int incirclexy_indirect_IIIE_bigfloat(const genericPoint& p1, const gener
 
 inline int incirclexy_indirect_IIIE_exact(const genericPoint& p1, const genericPoint& p2, const genericPoint& p3, double pdx, double pdy)
 {
+   COUNT_PREDICATE_STAGE(PF_INCIRCLE, PS_EXACT);
  double return_value = NAN;
 #ifdef CHECK_FOR_XYZERFLOWS
    feclearexcept(FE_ALL_EXCEPT);
@@ -3040,6 +3095,7 @@ inline int incirclexy_indirect_IIIE(const genericPoint& p1, const genericPoint&
 
 inline int incirclexy_indirect_IIII_interval(const genericPoint& p1, const genericPoint& p2, const genericPoint& p3, const genericPoint& p4)
 {
+   COUNT_PREDICATE_STAGE(PF_INCIRCLE, PS_INTERVAL);
    interval_number l1x, l1y, l1z, d1, l2x, l2y, l2z, d2, l3x, l3y, l3z, d3, l4x, l4y, l4z, d4;
    if (
    !p1.getIntervalLambda(l1x, l1y, l1z, d1)
@@ -3103,6 +3159,7 @@ inline int incirclexy_indirect_IIII_interval(const genericPoint& p1, const gener
 
 inline int incirclexy_indirect_IIII_bigfloat(const genericPoint& p1, const genericPoint& p2, const genericPoint& p3, const genericPoint& p4)
 {
+   COUNT_PREDICATE_STAGE(PF_INCIRCLE, PS_BIGFLOAT);
    bigfloat l1x, l1y, l1z, d1, l2x, l2y, l2z, d2, l3x, l3y, l3z, d3, l4x, l4y, l4z, d4;
    p1.getBigfloatLambda(l1x, l1y, l1z, d1);
    p2.getBigfloatLambda(l2x, l2y, l2z, d2);
@@ -3159,6 +3216,7 @@ inline int incirclexy_indirect_IIII_bigfloat(const genericPoint& p1, const gener
 
 inline int incirclexy_indirect_IIII_exact(const genericPoint& p1, const genericPoint& p2, const genericPoint& p3, const genericPoint& p4)
 {
+   COUNT_PREDICATE_STAGE(PF_INCIRCLE, PS_EXACT);
  double return_value = NAN;
 #ifdef CHECK_FOR_XYZERFLOWS
    feclearexcept(FE_ALL_EXCEPT);
@@ -3351,6 +3409,7 @@ inline int incirclexy_indirect_IIII(const genericPoint& p1, const genericPoint&
 
 inline int incircle_indirect_IEEE_interval(const genericPoint& p1, interval_number pbx, interval_number pby, interval_number pcx, interval_number pcy, interval_number pdx, interval_number pdy)
 {
+   COUNT_PREDICATE_STAGE(PF_INCIRCLE, PS_INTERVAL);
    interval_number l1x, l1y, d1;
    if (
    !p1.getIntervalLambda(l1x, l1y, d1)
@@ -3398,6 +3457,7 @@ inline int incircle_indirect_IEEE_interval(const genericPoint& p1, interval_numb
 
 inline int incircle_indirect_IEEE_bigfloat(const genericPoint& p1, bigfloat pbx, bigfloat pby, bigfloat pcx, bigfloat pcy, bigfloat pdx, bigfloat pdy)
 {
+   COUNT_PREDICATE_STAGE(PF_INCIRCLE, PS_BIGFLOAT);
    bigfloat l1x, l1y, d1;
    p1.getBigfloatLambda(l1x, l1y, d1);
    const bigfloat pdxt(pdx * d1);
@@ -3438,6 +3498,7 @@ inline int incircle_indirect_IEEE_bigfloat(const genericPoint& p1, bigfloat pbx,
 
 inline int incircle_indirect_IEEE_exact(const genericPoint& p1, double pbx, double pby, double pcx, double pcy, double pdx, double pdy)
 {
+   COUNT_PREDICATE_STAGE(PF_INCIRCLE, PS_EXACT);
  double return_value = NAN;
 #ifdef CHECK_FOR_XYZERFLOWS
    feclearexcept(FE_ALL_EXCEPT);
@@ -3562,6 +3623,7 @@ inline int incircle_indirect_IEEE(const genericPoint& p1, double pbx, double pby
 
 inline int incircle_indirect_IIEE_interval(const genericPoint& p1, const genericPoint& p2, interval_number pcx, interval_number pcy, interval_number pdx, interval_number pdy)
 {
+   COUNT_PREDICATE_STAGE(PF_INCIRCLE, PS_INTERVAL);
    interval_number l1x, l1y, d1, l2x, l2y, d2;
    if (
    !p1.getIntervalLambda(l1x, l1y, d1)
@@ -3613,6 +3675,7 @@ inline int incircle_indirect_IIEE_interval(const genericPoint& p1, const generic
 
 inline int incircle_indirect_IIEE_bigfloat(const genericPoint& p1, const genericPoint& p2, bigfloat pcx, bigfloat pcy, bigfloat pdx, bigfloat pdy)
 {
+   COUNT_PREDICATE_STAGE(PF_INCIRCLE, PS_BIGFLOAT);
    bigfloat l1x, l1y, d1, l2x, l2y, d2;
    p1.getBigfloatLambda(l1x, l1y, d1);
    p2.getBigfloatLambda(l2x, l2y, d2);
@@ -3657,6 +3720,7 @@ inline int incircle_indirect_IIEE_bigfloat(const genericPoint& p1, const generic
 
 inline int incircle_indirect_IIEE_exact(const genericPoint& p1, const genericPoint& p2, double pcx, double pcy, double pdx, double pdy)
 {
+   COUNT_PREDICATE_STAGE(PF_INCIRCLE, PS_EXACT);
  double return_value = NAN;
 #ifdef CHECK_FOR_XYZERFLOWS
    feclearexcept(FE_ALL_EXCEPT);
@@ -3802,6 +3866,7 @@ inline int incircle_indirect_IIEE(const genericPoint& p1, const genericPoint& p2
 
 inline int incircle_indirect_IIIE_interval(const genericPoint& p1, const genericPoint& p2, const genericPoint& p3, interval_number pdx, interval_number pdy)
 {
+   COUNT_PREDICATE_STAGE(PF_INCIRCLE, PS_INTERVAL);
    interval_number l1x, l1y, d1, l2x, l2y, d2, l3x, l3y, d3;
    if (
    !p1.getIntervalLambda(l1x, l1y, d1)
@@ -3858,6 +3923,7 @@ inline int incircle_indirect_IIIE_interval(const genericPoint& p1, const generic
 
 inline int incircle_indirect_IIIE_bigfloat(const genericPoint& p1, const genericPoint& p2, const genericPoint& p3, bigfloat pdx, bigfloat pdy)
 {
+   COUNT_PREDICATE_STAGE(PF_INCIRCLE, PS_BIGFLOAT);
    bigfloat l1x, l1y, d1, l2x, l2y, d2, l3x, l3y, d3;
    p1.getBigfloatLambda(l1x, l1y, d1);
    p2.getBigfloatLambda(l2x, l2y, d2);
@@ -3907,6 +3973,7 @@ inline int incircle_indirect_IIIE_bigfloat(const genericPoint& p1, const generic
 
 inline int incircle_indirect_IIIE_exact(const genericPoint& p1, const genericPoint& p2, const genericPoint& p3, double pdx, double pdy)
 {
+   COUNT_PREDICATE_STAGE(PF_INCIRCLE, PS_EXACT);
  double return_value = NAN;
 #ifdef CHECK_FOR_XYZERFLOWS
    feclearexcept(FE_ALL_EXCEPT);
@@ -4073,6 +4140,7 @@ inline int incircle_indirect_IIIE(const genericPoint& p1, const genericPoint& p2
 
 inline int incircle_indirect_IIII_interval(const genericPoint& p1, const genericPoint& p2, const genericPoint& p3, const genericPoint& p4)
 {
+   COUNT_PREDICATE_STAGE(PF_INCIRCLE, PS_INTERVAL);
    interval_number l1x, l1y, d1, l2x, l2y, d2, l3x, l3y, d3, l4x, l4y, d4;
    if (
    !p1.getIntervalLambda(l1x, l1y, d1)
@@ -4136,6 +4204,7 @@ inline int incircle_indirect_IIII_interval(const genericPoint& p1, const generic
 
 inline int incircle_indirect_IIII_bigfloat(const genericPoint& p1, const genericPoint& p2, const genericPoint& p3, const genericPoint& p4)
 {
+   COUNT_PREDICATE_STAGE(PF_INCIRCLE, PS_BIGFLOAT);
    bigfloat l1x, l1y, d1, l2x, l2y, d2, l3x, l3y, d3, l4x, l4y, d4;
    p1.getBigfloatLambda(l1x, l1y, d1);
    p2.getBigfloatLambda(l2x, l2y, d2);
@@ -4192,6 +4261,7 @@ inline int incircle_indirect_IIII_bigfloat(const genericPoint& p1, const generic
 
 inline int incircle_indirect_IIII_exact(const genericPoint& p1, const genericPoint& p2, const genericPoint& p3, const genericPoint& p4)
 {
+   COUNT_PREDICATE_STAGE(PF_INCIRCLE, PS_EXACT);
  double return_value = NAN;
 #ifdef CHECK_FOR_XYZERFLOWS
    feclearexcept(FE_ALL_EXCEPT);
@@ -4380,6 +4450,7 @@ inline int incircle_indirect_IIII(const genericPoint& p1, const genericPoint& p2
 
 inline int inSphere_IEEEE_interval(const genericPoint& p1, interval_number pbx, interval_number pby, interval_number pbz, interval_number pcx, interval_number pcy, interval_number pcz, interval_number pdx, interval_number pdy, interval_number pdz, interval_number pex, interval_number pey, interval_number pez)
 {
+   COUNT_PREDICATE_STAGE(PF_INSPHERE, PS_INTERVAL);
    interval_number l1x, l1y, l1z, d1;
    if (
    !p1.getIntervalLambda(l1x, l1y, l1z, d1)
@@ -4476,6 +4547,7 @@ inline int inSphere_IEEEE_interval(const genericPoint& p1, interval_number pbx,
 
 inline int inSphere_IEEEE_bigfloat(const genericPoint& p1, bigfloat pbx, bigfloat pby, bigfloat pbz, bigfloat pcx, bigfloat pcy, bigfloat pcz, bigfloat pdx, bigfloat pdy, bigfloat pdz, bigfloat pex, bigfloat pey, bigfloat pez)
 {
+   COUNT_PREDICATE_STAGE(PF_INSPHERE, PS_BIGFLOAT);
    bigfloat l1x, l1y, l1z, d1;
    p1.getBigfloatLambda(l1x, l1y, l1z, d1);
    const bigfloat pexd(pex * d1);
@@ -4565,6 +4637,7 @@ inline int inSphere_IEEEE_bigfloat(const genericPoint& p1, bigfloat pbx, bigfloa
 
 inline int inSphere_IEEEE_exact(const genericPoint& p1, double pbx, double pby, double pbz, double pcx, double pcy, double pcz, double pdx, double pdy, double pdz, double pex, double pey, double pez)
 {
+   COUNT_PREDICATE_STAGE(PF_INSPHERE, PS_EXACT);
  double return_value = NAN;
 #ifdef CHECK_FOR_XYZERFLOWS
    feclearexcept(FE_ALL_EXCEPT);
@@ -4820,6 +4893,7 @@ inline int inSphere_IEEEE(const genericPoint& p1, double pbx, double pby, double
 
 inline int inSphere_IIEEE_interval(const genericPoint& p1, const genericPoint& p2, interval_number pcx, interval_number pcy, interval_number pcz, interval_number pdx, interval_number pdy, interval_number pdz, interval_number pex, interval_number pey, interval_number pez)
 {
+   COUNT_PREDICATE_STAGE(PF_INSPHERE, PS_INTERVAL);
    interval_number l1x, l1y, l1z, d1, l2x, l2y, l2z, d2;
    if (
    !p1.getIntervalLambda(l1x, l1y, l1z, d1)
@@ -4922,6 +4996,7 @@ inline int inSphere_IIEEE_interval(const genericPoint& p1, const genericPoint& p
 
 inline int inSphere_IIEEE_bigfloat(const genericPoint& p1, const genericPoint& p2, bigfloat pcx, bigfloat pcy, bigfloat pcz, bigfloat pdx, bigfloat pdy, bigfloat pdz, bigfloat pex, bigfloat pey, bigfloat pez)
 {
+   COUNT_PREDICATE_STAGE(PF_INSPHERE, PS_BIGFLOAT);
    bigfloat l1x, l1y, l1z, d1, l2x, l2y, l2z, d2;
    p1.getBigfloatLambda(l1x, l1y, l1z, d1);
    p2.getBigfloatLambda(l2x, l2y, l2z, d2);
@@ -5017,6 +5092,7 @@ inline int inSphere_IIEEE_bigfloat(const genericPoint& p1, const genericPoint& p
 
 inline int inSphere_IIEEE_exact(const genericPoint& p1, const genericPoint& p2, double pcx, double pcy, double pcz, double pdx, double pdy, double pdz, double pex, double pey, double pez)
 {
+   COUNT_PREDICATE_STAGE(PF_INSPHERE, PS_EXACT);
  double return_value = NAN;
 #ifdef CHECK_FOR_XYZERFLOWS
    feclearexcept(FE_ALL_EXCEPT);
@@ -5305,6 +5381,7 @@ inline int inSphere_IIEEE(const genericPoint& p1, const genericPoint& p2, double
 
 inline int inSphere_IIIEE_interval(const genericPoint& p1, const genericPoint& p2, const genericPoint& p3, interval_number pdx, interval_number pdy, interval_number pdz, interval_number pex, interval_number pey, interval_number pez)
 {
+   COUNT_PREDICATE_STAGE(PF_INSPHERE, PS_INTERVAL);
    interval_number l1x, l1y, l1z, d1, l2x, l2y, l2z, d2, l3x, l3y, l3z, d3;
    if (
    !p1.getIntervalLambda(l1x, l1y, l1z, d1)
@@ -5413,6 +5490,7 @@ inline int inSphere_IIIEE_interval(const genericPoint& p1, const genericPoint& p
 
 inline int inSphere_IIIEE_bigfloat(const genericPoint& p1, const genericPoint& p2, const genericPoint& p3, bigfloat pdx, bigfloat pdy, bigfloat pdz, bigfloat pex, bigfloat pey, bigfloat pez)
 {
+   COUNT_PREDICATE_STAGE(PF_INSPHERE, PS_BIGFLOAT);
    bigfloat l1x, l1y, l1z, d1, l2x, l2y, l2z, d2, l3x, l3y, l3z, d3;
    p1.getBigfloatLambda(l1x, l1y, l1z, d1);
    p2.getBigfloatLambda(l2x, l2y, l2z, d2);
@@ -5514,6 +5592,7 @@ inline int inSphere_IIIEE_bigfloat(const genericPoint& p1, const genericPoint& p
 
 inline int inSphere_IIIEE_exact(const genericPoint& p1, const genericPoint& p2, const genericPoint& p3, double pdx, double pdy, double pdz, double pex, double pey, double pez)
 {
+   COUNT_PREDICATE_STAGE(PF_INSPHERE, PS_EXACT);
  double return_value = NAN;
 #ifdef CHECK_FOR_XYZERFLOWS
    feclearexcept(FE_ALL_EXCEPT);
@@ -5832,6 +5911,7 @@ inline int inSphere_IIIEE(const genericPoint& p1, const genericPoint& p2, const
 
 inline int inSphere_IIIIE_interval(const genericPoint& p1, const genericPoint& p2, const genericPoint& p3, const genericPoint& p4, interval_number pex, interval_number pey, interval_number pez)
 {
+   COUNT_PREDICATE_STAGE(PF_INSPHERE, PS_INTERVAL);
    interval_number l1x, l1y, l1z, d1, l2x, l2y, l2z, d2, l3x, l3y, l3z, d3, l4x, l4y, l4z, d4;
    if (
    !p1.getIntervalLambda(l1x, l1y, l1z, d1)
@@ -5946,6 +6026,7 @@ inline int inSphere_IIIIE_interval(const genericPoint& p1, const genericPoint& p
 
 inline int inSphere_IIIIE_bigfloat(const genericPoint& p1, const genericPoint& p2, const genericPoint& p3, const genericPoint& p4, bigfloat pex, bigfloat pey, bigfloat pez)
 {
+   COUNT_PREDICATE_STAGE(PF_INSPHERE, PS_BIGFLOAT);
    bigfloat l1x, l1y, l1z, d1, l2x, l2y, l2z, d2, l3x, l3y, l3z, d3, l4x, l4y, l4z, d4;
    p1.getBigfloatLambda(l1x, l1y, l1z, d1);
    p2.getBigfloatLambda(l2x, l2y, l2z, d2);
@@ -6053,6 +6134,7 @@ inline int inSphere_IIIIE_bigfloat(const genericPoint& p1, const genericPoint& p
 
 inline int inSphere_IIIIE_exact(const genericPoint& p1, const genericPoint& p2, const genericPoint& p3, const genericPoint& p4, double pex, double pey, double pez)
 {
+   COUNT_PREDICATE_STAGE(PF_INSPHERE, PS_EXACT);
  double return_value = NAN;
 #ifdef CHECK_FOR_XYZERFLOWS
    feclearexcept(FE_ALL_EXCEPT);
@@ -6398,6 +6480,7 @@ inline int inSphere_IIIIE(const genericPoint& p1, const genericPoint& p2, const
 
 inline int inSphere_IIIII_interval(const genericPoint& p1, const genericPoint& p2, const genericPoint& p3, const genericPoint& p4, const genericPoint& p5)
 {
+   COUNT_PREDICATE_STAGE(PF_INSPHERE, PS_INTERVAL);
    interval_number l1x, l1y, l1z, d1, l2x, l2y, l2z, d2, l3x, l3y, l3z, d3, l4x, l4y, l4z, d4, l5x, l5y, l5z, d5;
    if (
    !p1.getIntervalLambda(l1x, l1y, l1z, d1)
@@ -6525,6 +6608,7 @@ inline int inSphere_IIIII_interval(const genericPoint& p1, const genericPoint& p
 
 inline int inSphere_IIIII_bigfloat(const genericPoint& p1, const genericPoint& p2, const genericPoint& p3, const genericPoint& p4, const genericPoint& p5)
 {
+   COUNT_PREDICATE_STAGE(PF_INSPHERE, PS_BIGFLOAT);
    bigfloat l1x, l1y, l1z, d1, l2x, l2y, l2z, d2, l3x, l3y, l3z, d3, l4x, l4y, l4z, d4, l5x, l5y, l5z, d5;
    p1.getBigfloatLambda(l1x, l1y, l1z, d1);
    p2.getBigfloatLambda(l2x, l2y, l2z, d2);
@@ -6645,6 +6729,7 @@ inline int inSphere_IIIII_bigfloat(const genericPoint& p1, const genericPoint& p
 
 inline int inSphere_IIIII_exact(const genericPoint& p1, const genericPoint& p2, const genericPoint& p3, const genericPoint& p4, const genericPoint& p5)
 {
+   COUNT_PREDICATE_STAGE(PF_INSPHERE, PS_EXACT);
  double return_value = NAN;
 #ifdef CHECK_FOR_XYZERFLOWS
    feclearexcept(FE_ALL_EXCEPT);
@@ -7863,6 +7948,7 @@ inline void lambda3d_TPI_exact(double ov1x, double ov1y, double ov1z, double ov2
 
 inline int lessThanOnX_IE_interval(const genericPoint& p1, interval_number bx)
 {
+   COUNT_PREDICATE_STAGE(PF_LESSTHAN, PS_INTERVAL);
    interval_number l1x, l1y, l1z, d1;
    if (
    !p1.getIntervalLambda(l1x, l1y, l1z, d1)
@@ -7879,6 +7965,7 @@ inline int lessThanOnX_IE_interval(const genericPoint& p1, interval_number bx)
 
 inline int lessThanOnX_IE_bigfloat(const genericPoint& p1, bigfloat bx)
 {
+   COUNT_PREDICATE_STAGE(PF_LESSTHAN, PS_BIGFLOAT);
    bigfloat l1x, l1y, l1z, d1;
    p1.getBigfloatLambda(l1x, l1y, l1z, d1);
    const bigfloat dbx(bx * d1);
@@ -7888,6 +7975,7 @@ inline int lessThanOnX_IE_bigfloat(const genericPoint& p1, bigfloat bx)
 
 inline int lessThanOnX_IE_exact(const genericPoint& p1, double bx)
 {
+   COUNT_PREDICATE_STAGE(PF_LESSTHAN, PS_EXACT);
  double return_value = NAN;
 #ifdef CHECK_FOR_XYZERFLOWS
    feclearexcept(FE_ALL_EXCEPT);
@@ -7929,6 +8017,7 @@ inline int lessThanOnX_IE(const genericPoint& p1, double bx)
 
 inline int lessThanOnX_II_interval(const genericPoint& p1, const genericPoint& p2)
 {
+   COUNT_PREDICATE_STAGE(PF_LESSTHAN, PS_INTERVAL);
    interval_number l1x, l1y, l1z, d1, l2x, l2y, l2z, d2;
    if (
    !p1.getIntervalLambda(l1x, l1y, l1z, d1)
@@ -7947,6 +8036,7 @@ inline int lessThanOnX_II_interval(const genericPoint& p1, const genericPoint& p
 
 inline int lessThanOnX_II_bigfloat(const genericPoint& p1, const genericPoint& p2)
 {
+   COUNT_PREDICATE_STAGE(PF_LESSTHAN, PS_BIGFLOAT);
    bigfloat l1x, l1y, l1z, d1, l2x, l2y, l2z, d2;
    p1.getBigfloatLambda(l1x, l1y, l1z, d1);
    p2.getBigfloatLambda(l2x, l2y, l2z, d2);
@@ -7958,6 +8048,7 @@ inline int lessThanOnX_II_bigfloat(const genericPoint& p1, const genericPoint& p
 
 inline int lessThanOnX_II_exact(const genericPoint& p1, const genericPoint& p2)
 {
+   COUNT_PREDICATE_STAGE(PF_LESSTHAN, PS_EXACT);
  double return_value = NAN;
 #ifdef CHECK_FOR_XYZERFLOWS
    feclearexcept(FE_ALL_EXCEPT);
@@ -8003,6 +8094,7 @@ inline int lessThanOnX_II(const genericPoint& p1, const genericPoint& p2)
 
 inline int lessThanOnY_IE_interval(const genericPoint& p1, interval_number by)
 {
+   COUNT_PREDICATE_STAGE(PF_LESSTHAN, PS_INTERVAL);
    interval_number l1x, l1y, l1z, d1;
    if (
    !p1.getIntervalLambda(l1x, l1y, l1z, d1)
@@ -8019,6 +8111,7 @@ inline int lessThanOnY_IE_interval(const genericPoint& p1, interval_number by)
 
 inline int lessThanOnY_IE_bigfloat(const genericPoint& p1, bigfloat by)
 {
+   COUNT_PREDICATE_STAGE(PF_LESSTHAN, PS_BIGFLOAT);
    bigfloat l1x, l1y, l1z, d1;
    p1.getBigfloatLambda(l1x, l1y, l1z, d1);
    const bigfloat dby(by * d1);
@@ -8028,6 +8121,7 @@ inline int lessThanOnY_IE_bigfloat(const genericPoint& p1, bigfloat by)
 
 inline int lessThanOnY_IE_exact(const genericPoint& p1, double by)
 {
+   COUNT_PREDICATE_STAGE(PF_LESSTHAN, PS_EXACT);
  double return_value = NAN;
 #ifdef CHECK_FOR_XYZERFLOWS
    feclearexcept(FE_ALL_EXCEPT);
@@ -8069,6 +8163,7 @@ inline int lessThanOnY_IE(const genericPoint& p1, double by)
 
 inline int lessThanOnY_II_interval(const genericPoint& p1, const genericPoint& p2)
 {
+   COUNT_PREDICATE_STAGE(PF_LESSTHAN, PS_INTERVAL);
    interval_number l1x, l1y, l1z, d1, l2x, l2y, l2z, d2;
    if (
    !p1.getIntervalLambda(l1x, l1y, l1z, d1)
@@ -8087,6 +8182,7 @@ inline int lessThanOnY_II_interval(const genericPoint& p1, const genericPoint& p
 
 inline int lessThanOnY_II_bigfloat(const genericPoint& p1, const genericPoint& p2)
 {
+   COUNT_PREDICATE_STAGE(PF_LESSTHAN, PS_BIGFLOAT);
    bigfloat l1x, l1y, l1z, d1, l2x, l2y, l2z, d2;
    p1.getBigfloatLambda(l1x, l1y, l1z, d1);
    p2.getBigfloatLambda(l2x, l2y, l2z, d2);
@@ -8098,6 +8194,7 @@ inline int lessThanOnY_II_bigfloat(const genericPoint& p1, const genericPoint& p
 
 inline int lessThanOnY_II_exact(const genericPoint& p1, const genericPoint& p2)
 {
+   COUNT_PREDICATE_STAGE(PF_LESSTHAN, PS_EXACT);
  double return_value = NAN;
 #ifdef CHECK_FOR_XYZERFLOWS
    feclearexcept(FE_ALL_EXCEPT);
@@ -8143,6 +8240,7 @@ inline int lessThanOnY_II(const genericPoint& p1, const genericPoint& p2)
 
 inline int lessThanOnZ_IE_interval(const genericPoint& p1, interval_number bz)
 {
+   COUNT_PREDICATE_STAGE(PF_LESSTHAN, PS_INTERVAL);
    interval_number l1x, l1y, l1z, d1;
    if (
    !p1.getIntervalLambda(l1x, l1y, l1z, d1)
@@ -8159,6 +8257,7 @@ inline int lessThanOnZ_IE_interval(const genericPoint& p1, interval_number bz)
 
 inline int lessThanOnZ_IE_bigfloat(const genericPoint& p1, bigfloat bz)
 {
+   COUNT_PREDICATE_STAGE(PF_LESSTHAN, PS_BIGFLOAT);
    bigfloat l1x, l1y, l1z, d1;
    p1.getBigfloatLambda(l1x, l1y, l1z, d1);
    const bigfloat dbz(bz * d1);
@@ -8168,6 +8267,7 @@ inline int lessThanOnZ_IE_bigfloat(const genericPoint& p1, bigfloat bz)
 
 inline int lessThanOnZ_IE_exact(const genericPoint& p1, double bz)
 {
+   COUNT_PREDICATE_STAGE(PF_LESSTHAN, PS_EXACT);
  double return_value = NAN;
 #ifdef CHECK_FOR_XYZERFLOWS
    feclearexcept(FE_ALL_EXCEPT);
@@ -8209,6 +8309,7 @@ inline int lessThanOnZ_IE(const genericPoint& p1, double bz)
 
 inline int lessThanOnZ_II_interval(const genericPoint& p1, const genericPoint& p2)
 {
+   COUNT_PREDICATE_STAGE(PF_LESSTHAN, PS_INTERVAL);
    interval_number l1x, l1y, l1z, d1, l2x, l2y, l2z, d2;
    if (
    !p1.getIntervalLambda(l1x, l1y, l1z, d1)
@@ -8227,6 +8328,7 @@ inline int lessThanOnZ_II_interval(const genericPoint& p1, const genericPoint& p
 
 inline int lessThanOnZ_II_bigfloat(const genericPoint& p1, const genericPoint& p2)
 {
+   COUNT_PREDICATE_STAGE(PF_LESSTHAN, PS_BIGFLOAT);
    bigfloat l1x, l1y, l1z, d1, l2x, l2y, l2z, d2;
    p1.getBigfloatLambda(l1x, l1y, l1z, d1);
    p2.getBigfloatLambda(l2x, l2y, l2z, d2);
@@ -8238,6 +8340,7 @@ inline int lessThanOnZ_II_bigfloat(const genericPoint& p1, const genericPoint& p
 
 inline int lessThanOnZ_II_exact(const genericPoint& p1, const genericPoint& p2)
 {
+   COUNT_PREDICATE_STAGE(PF_LESSTHAN, PS_EXACT);
  double return_value = NAN;
 #ifdef CHECK_FOR_XYZERFLOWS
    feclearexcept(FE_ALL_EXCEPT);
@@ -8283,6 +8386,7 @@ inline int lessThanOnZ_II(const genericPoint& p1, const genericPoint& p2)
 
 inline int orient2dxy_indirect_IEE_interval(const genericPoint& p1, interval_number p2x, interval_number p2y, interval_number p3x, interval_number p3y)
 {
+   COUNT_PREDICATE_STAGE(PF_ORIENT2D, PS_INTERVAL);
    interval_number l1x, l1y, l1z, d1;
    if (
    !p1.getIntervalLambda(l1x, l1y, l1z, d1)
@@ -8307,6 +8411,7 @@ inline int orient2dxy_indirect_IEE_interval(const genericPoint& p1, interval_num
 
 inline int orient2dxy_indirect_IEE_bigfloat(const genericPoint& p1, bigfloat p2x, bigfloat p2y, bigfloat p3x, bigfloat p3y)
 {
+   COUNT_PREDICATE_STAGE(PF_ORIENT2D, PS_BIGFLOAT);
    bigfloat l1x, l1y, l1z, d1;
    p1.getBigfloatLambda(l1x, l1y, l1z, d1);
    const bigfloat t1x(p2y - p3y);
@@ -8324,6 +8429,7 @@ inline int orient2dxy_indirect_IEE_bigfloat(const genericPoint& p1, bigfloat p2x
 
 inline int orient2dxy_indirect_IEE_exact(const genericPoint& p1, double p2x, double p2y, double p3x, double p3y)
 {
+   COUNT_PREDICATE_STAGE(PF_ORIENT2D, PS_EXACT);
  double return_value = NAN;
 #ifdef CHECK_FOR_XYZERFLOWS
    feclearexcept(FE_ALL_EXCEPT);
@@ -8384,6 +8490,7 @@ inline int orient2dxy_indirect_IEE(const genericPoint& p1, double p2x, double p2
 
 inline int orient2dxy_indirect_IIE_interval(const genericPoint& p1, const genericPoint& p2, interval_number op3x, interval_number op3y)
 {
+   COUNT_PREDICATE_STAGE(PF_ORIENT2D, PS_INTERVAL);
    interval_number l1x, l1y, l1z, d1, l2x, l2y, l2z, d2;
    if (
    !p1.getIntervalLambda(l1x, l1y, l1z, d1)
@@ -8412,6 +8519,7 @@ inline int orient2dxy_indirect_IIE_interval(const genericPoint& p1, const generi
 
 inline int orient2dxy_indirect_IIE_bigfloat(const genericPoint& p1, const genericPoint& p2, bigfloat op3x, bigfloat op3y)
 {
+   COUNT_PREDICATE_STAGE(PF_ORIENT2D, PS_BIGFLOAT);
    bigfloat l1x, l1y, l1z, d1, l2x, l2y, l2z, d2;
    p1.getBigfloatLambda(l1x, l1y, l1z, d1);
    p2.getBigfloatLambda(l2x, l2y, l2z, d2);
@@ -8433,6 +8541,7 @@ inline int orient2dxy_indirect_IIE_bigfloat(const genericPoint& p1, const generi
 
 inline int orient2dxy_indirect_IIE_exact(const genericPoint& p1, const genericPoint& p2, double op3x, double op3y)
 {
+   COUNT_PREDICATE_STAGE(PF_ORIENT2D, PS_EXACT);
  double return_value = NAN;
 #ifdef CHECK_FOR_XYZERFLOWS
    feclearexcept(FE_ALL_EXCEPT);
@@ -8516,6 +8625,7 @@ inline int orient2dxy_indirect_IIE(const genericPoint& p1, const genericPoint& p
 
 inline int orient2dxy_indirect_III_interval(const genericPoint& p1, const genericPoint& p2, const genericPoint& p3)
 {
+   COUNT_PREDICATE_STAGE(PF_ORIENT2D, PS_INTERVAL);
    interval_number l1x, l1y, l1z, d1, l2x, l2y, l2z, d2, l3x, l3y, l3z, d3;
    if (
    !p1.getIntervalLambda(l1x, l1y, l1z, d1)
@@ -8547,6 +8657,7 @@ inline int orient2dxy_indirect_III_interval(const genericPoint& p1, const generi
 
 inline int orient2dxy_indirect_III_bigfloat(const genericPoint& p1, const genericPoint& p2, const genericPoint& p3)
 {
+   COUNT_PREDICATE_STAGE(PF_ORIENT2D, PS_BIGFLOAT);
    bigfloat l1x, l1y, l1z, d1, l2x, l2y, l2z, d2, l3x, l3y, l3z, d3;
    p1.getBigfloatLambda(l1x, l1y, l1z, d1);
    p2.getBigfloatLambda(l2x, l2y, l2z, d2);
@@ -8571,6 +8682,7 @@ inline int orient2dxy_indirect_III_bigfloat(const genericPoint& p1, const generi
 
 inline int orient2dxy_indirect_III_exact(const genericPoint& p1, const genericPoint& p2, const genericPoint& p3)
 {
+   COUNT_PREDICATE_STAGE(PF_ORIENT2D, PS_EXACT);
  double return_value = NAN;
 #ifdef CHECK_FOR_XYZERFLOWS
    feclearexcept(FE_ALL_EXCEPT);
@@ -8665,6 +8777,7 @@ inline int orient2dxy_indirect_III(const genericPoint& p1, const genericPoint& p
 
 inline int orient2dyz_indirect_IEE_interval(const genericPoint& p1, interval_number p2x, interval_number p2y, interval_number p3x, interval_number p3y)
 {
+   COUNT_PREDICATE_STAGE(PF_ORIENT2D, PS_INTERVAL);
    interval_number l1z, l1x, l1y, d1;
    if (
    !p1.getIntervalLambda(l1z, l1x, l1y, d1)
@@ -8689,6 +8802,7 @@ inline int orient2dyz_indirect_IEE_interval(const genericPoint& p1, interval_num
 
 inline int orient2dyz_indirect_IEE_bigfloat(const genericPoint& p1, bigfloat p2x, bigfloat p2y, bigfloat p3x, bigfloat p3y)
 {
+   COUNT_PREDICATE_STAGE(PF_ORIENT2D, PS_BIGFLOAT);
    bigfloat l1z, l1x, l1y, d1;
    p1.getBigfloatLambda(l1z, l1x, l1y, d1);
    const bigfloat t1x(p2y - p3y);
@@ -8706,6 +8820,7 @@ inline int orient2dyz_indirect_IEE_bigfloat(const genericPoint& p1, bigfloat p2x
 
 inline int orient2dyz_indirect_IEE_exact(const genericPoint& p1, double p2x, double p2y, double p3x, double p3y)
 {
+   COUNT_PREDICATE_STAGE(PF_ORIENT2D, PS_EXACT);
  double return_value = NAN;
 #ifdef CHECK_FOR_XYZERFLOWS
    feclearexcept(FE_ALL_EXCEPT);
@@ -8766,6 +8881,7 @@ inline int orient2dyz_indirect_IEE(const genericPoint& p1, double p2x, double p2
 
 inline int orient2dyz_indirect_IIE_interval(const genericPoint& p1, const genericPoint& p2, interval_number op3x, interval_number op3y)
 {
+   COUNT_PREDICATE_STAGE(PF_ORIENT2D, PS_INTERVAL);
    interval_number l1z, l1x, l1y, d1, l2z, l2x, l2y, d2;
    if (
    !p1.getIntervalLambda(l1z, l1x, l1y, d1)
@@ -8794,6 +8910,7 @@ inline int orient2dyz_indirect_IIE_interval(const genericPoint& p1, const generi
 
 inline int orient2dyz_indirect_IIE_bigfloat(const genericPoint& p1, const genericPoint& p2, bigfloat op3x, bigfloat op3y)
 {
+   COUNT_PREDICATE_STAGE(PF_ORIENT2D, PS_BIGFLOAT);
    bigfloat l1z, l1x, l1y, d1, l2z, l2x, l2y, d2;
    p1.getBigfloatLambda(l1z, l1x, l1y, d1);
    p2.getBigfloatLambda(l2z, l2x, l2y, d2);
@@ -8815,6 +8932,7 @@ inline int orient2dyz_indirect_IIE_bigfloat(const genericPoint& p1, const generi
 
 inline int orient2dyz_indirect_IIE_exact(const genericPoint& p1, const genericPoint& p2, double op3x, double op3y)
 {
+   COUNT_PREDICATE_STAGE(PF_ORIENT2D, PS_EXACT);
  double return_value = NAN;
 #ifdef CHECK_FOR_XYZERFLOWS
    feclearexcept(FE_ALL_EXCEPT);
@@ -8898,6 +9016,7 @@ inline int orient2dyz_indirect_IIE(const genericPoint& p1, const genericPoint& p
 
 inline int orient2dyz_indirect_III_interval(const genericPoint& p1, const genericPoint& p2, const genericPoint& p3)
 {
+   COUNT_PREDICATE_STAGE(PF_ORIENT2D, PS_INTERVAL);
    interval_number l1z, l1x, l1y, d1, l2z, l2x, l2y, d2, l3z, l3x, l3y, d3;
    if (
    !p1.getIntervalLambda(l1z, l1x, l1y, d1)
@@ -8929,6 +9048,7 @@ inline int orient2dyz_indirect_III_interval(const genericPoint& p1, const generi
 
 inline int orient2dyz_indirect_III_bigfloat(const genericPoint& p1, const genericPoint& p2, const genericPoint& p3)
 {
+   COUNT_PREDICATE_STAGE(PF_ORIENT2D, PS_BIGFLOAT);
    bigfloat l1z, l1x, l1y, d1, l2z, l2x, l2y, d2, l3z, l3x, l3y, d3;
    p1.getBigfloatLambda(l1z, l1x, l1y, d1);
    p2.getBigfloatLambda(l2z, l2x, l2y, d2);
@@ -8953,6 +9073,7 @@ inline int orient2dyz_indirect_III_bigfloat(const genericPoint& p1, const generi
 
 inline int orient2dyz_indirect_III_exact(const genericPoint& p1, const genericPoint& p2, const genericPoint& p3)
 {
+   COUNT_PREDICATE_STAGE(PF_ORIENT2D, PS_EXACT);
  double return_value = NAN;
 #ifdef CHECK_FOR_XYZERFLOWS
    feclearexcept(FE_ALL_EXCEPT);
@@ -9047,6 +9168,7 @@ inline int orient2dyz_indirect_III(const genericPoint& p1, const genericPoint& p
 
 inline int orient2dzx_indirect_IEE_interval(const genericPoint& p1, interval_number p2x, interval_number p2y, interval_number p3x, interval_number p3y)
 {
+   COUNT_PREDICATE_STAGE(PF_ORIENT2D, PS_INTERVAL);
    interval_number l1y, l1z, l1x, d1;
    if (
    !p1.getIntervalLambda(l1y, l1z, l1x, d1)
@@ -9071,6 +9193,7 @@ inline int orient2dzx_indirect_IEE_interval(const genericPoint& p1, interval_num
 
 inline int orient2dzx_indirect_IEE_bigfloat(const genericPoint& p1, bigfloat p2x, bigfloat p2y, bigfloat p3x, bigfloat p3y)
 {
+   COUNT_PREDICATE_STAGE(PF_ORIENT2D, PS_BIGFLOAT);
    bigfloat l1y, l1z, l1x, d1;
    p1.getBigfloatLambda(l1y, l1z, l1x, d1);
    const bigfloat t1x(p2y - p3y);
@@ -9088,6 +9211,7 @@ inline int orient2dzx_indirect_IEE_bigfloat(const genericPoint& p1, bigfloat p2x
 
 inline int orient2dzx_indirect_IEE_exact(const genericPoint& p1, double p2x, double p2y, double p3x, double p3y)
 {
+   COUNT_PREDICATE_STAGE(PF_ORIENT2D, PS_EXACT);
  double return_value = NAN;
 #ifdef CHECK_FOR_XYZERFLOWS
    feclearexcept(FE_ALL_EXCEPT);
@@ -9148,6 +9272,7 @@ inline int orient2dzx_indirect_IEE(const genericPoint& p1, double p2x, double p2
 
 inline int orient2dzx_indirect_IIE_interval(const genericPoint& p1, const genericPoint& p2, interval_number op3x, interval_number op3y)
 {
+   COUNT_PREDICATE_STAGE(PF_ORIENT2D, PS_INTERVAL);
    interval_number l1y, l1z, l1x, d1, l2y, l2z, l2x, d2;
    if (
    !p1.getIntervalLambda(l1y, l1z, l1x, d1)
@@ -9176,6 +9301,7 @@ inline int orient2dzx_indirect_IIE_interval(const genericPoint& p1, const generi
 
 inline int orient2dzx_indirect_IIE_bigfloat(const genericPoint& p1, const genericPoint& p2, bigfloat op3x, bigfloat op3y)
 {
+   COUNT_PREDICATE_STAGE(PF_ORIENT2D, PS_BIGFLOAT);
    bigfloat l1y, l1z, l1x, d1, l2y, l2z, l2x, d2;
    p1.getBigfloatLambda(l1y, l1z, l1x, d1);
    p2.getBigfloatLambda(l2y, l2z, l2x, d2);
@@ -9197,6 +9323,7 @@ inline int orient2dzx_indirect_IIE_bigfloat(const genericPoint& p1, const generi
 
 inline int orient2dzx_indirect_IIE_exact(const genericPoint& p1, const genericPoint& p2, double op3x, double op3y)
 {
+   COUNT_PREDICATE_STAGE(PF_ORIENT2D, PS_EXACT);
  double return_value = NAN;
 #ifdef CHECK_FOR_XYZERFLOWS
    feclearexcept(FE_ALL_EXCEPT);
@@ -9280,6 +9407,7 @@ inline int orient2dzx_indirect_IIE(const genericPoint& p1, const genericPoint& p
 
 inline int orient2dzx_indirect_III_interval(const genericPoint& p1, const genericPoint& p2, const genericPoint& p3)
 {
+   COUNT_PREDICATE_STAGE(PF_ORIENT2D, PS_INTERVAL);
    interval_number l1y, l1z, l1x, d1, l2y, l2z, l2x, d2, l3y, l3z, l3x, d3;
    if (
    !p1.getIntervalLambda(l1y, l1z, l1x, d1)
@@ -9311,6 +9439,7 @@ inline int orient2dzx_indirect_III_interval(const genericPoint& p1, const generi
 
 inline int orient2dzx_indirect_III_bigfloat(const genericPoint& p1, const genericPoint& p2, const genericPoint& p3)
 {
+   COUNT_PREDICATE_STAGE(PF_ORIENT2D, PS_BIGFLOAT);
    bigfloat l1y, l1z, l1x, d1, l2y, l2z, l2x, d2, l3y, l3z, l3x, d3;
    p1.getBigfloatLambda(l1y, l1z, l1x, d1);
    p2.getBigfloatLambda(l2y, l2z, l2x, d2);
@@ -9335,6 +9464,7 @@ inline int orient2dzx_indirect_III_bigfloat(const genericPoint& p1, const generi
 
 inline int orient2dzx_indirect_III_exact(const genericPoint& p1, const genericPoint& p2, const genericPoint& p3)
 {
+   COUNT_PREDICATE_STAGE(PF_ORIENT2D, PS_EXACT);
  double return_value = NAN;
 #ifdef CHECK_FOR_XYZERFLOWS
    feclearexcept(FE_ALL_EXCEPT);
@@ -9429,6 +9559,7 @@ inline int orient2dzx_indirect_III(const genericPoint& p1, const genericPoint& p
 
 inline int orient2d_indirect_IEE_interval(const genericPoint& p1, interval_number p2x, interval_number p2y, interval_number p3x, interval_number p3y)
 {
+   COUNT_PREDICATE_STAGE(PF_ORIENT2D, PS_INTERVAL);
    interval_number l1x, l1y, d1;
    if (
    !p1.getIntervalLambda(l1x, l1y, d1)
@@ -9453,6 +9584,7 @@ inline int orient2d_indirect_IEE_interval(const genericPoint& p1, interval_numbe
 
 inline int orient2d_indirect_IEE_bigfloat(const genericPoint& p1, bigfloat p2x, bigfloat p2y, bigfloat p3x, bigfloat p3y)
 {
+   COUNT_PREDICATE_STAGE(PF_ORIENT2D, PS_BIGFLOAT);
    bigfloat l1x, l1y, d1;
    p1.getBigfloatLambda(l1x, l1y, d1);
    const bigfloat t1x(p2y - p3y);
@@ -9470,6 +9602,7 @@ inline int orient2d_indirect_IEE_bigfloat(const genericPoint& p1, bigfloat p2x,
 
 inline int orient2d_indirect_IEE_exact(const genericPoint& p1, double p2x, double p2y, double p3x, double p3y)
 {
+   COUNT_PREDICATE_STAGE(PF_ORIENT2D, PS_EXACT);
  double return_value = NAN;
 #ifdef CHECK_FOR_XYZERFLOWS
    feclearexcept(FE_ALL_EXCEPT);
@@ -9530,6 +9663,7 @@ inline int orient2d_indirect_IEE(const genericPoint& p1, double p2x, double p2y,
 
 inline int orient2d_indirect_IIE_interval(const genericPoint& p1, const genericPoint& p2, interval_number p3x, interval_number p3y)
 {
+   COUNT_PREDICATE_STAGE(PF_ORIENT2D, PS_INTERVAL);
    interval_number l1x, l1y, d1, l2x, l2y, d2;
    if (
    !p1.getIntervalLambda(l1x, l1y, d1)
@@ -9558,6 +9692,7 @@ inline int orient2d_indirect_IIE_interval(const genericPoint& p1, const genericP
 
 inline int orient2d_indirect_IIE_bigfloat(const genericPoint& p1, const genericPoint& p2, bigfloat p3x, bigfloat p3y)
 {
+   COUNT_PREDICATE_STAGE(PF_ORIENT2D, PS_BIGFLOAT);
    bigfloat l1x, l1y, d1, l2x, l2y, d2;
    p1.getBigfloatLambda(l1x, l1y, d1);
    p2.getBigfloatLambda(l2x, l2y, d2);
@@ -9579,6 +9714,7 @@ inline int orient2d_indirect_IIE_bigfloat(const genericPoint& p1, const genericP
 
 inline int orient2d_indirect_IIE_exact(const genericPoint& p1, const genericPoint& p2, double p3x, double p3y)
 {
+   COUNT_PREDICATE_STAGE(PF_ORIENT2D, PS_EXACT);
  double return_value = NAN;
 #ifdef CHECK_FOR_XYZERFLOWS
    feclearexcept(FE_ALL_EXCEPT);
@@ -9660,6 +9796,7 @@ inline int orient2d_indirect_IIE(const genericPoint& p1, const genericPoint& p2,
 
 inline int orient2d_indirect_III_interval(const genericPoint& p1, const genericPoint& p2, const genericPoint& p3)
 {
+   COUNT_PREDICATE_STAGE(PF_ORIENT2D, PS_INTERVAL);
    interval_number l1x, l1y, d1, l2x, l2y, d2, l3x, l3y, d3;
    if (
    !p1.getIntervalLambda(l1x, l1y, d1)
@@ -9691,6 +9828,7 @@ inline int orient2d_indirect_III_interval(const genericPoint& p1, const genericP
 
 inline int orient2d_indirect_III_bigfloat(const genericPoint& p1, const genericPoint& p2, const genericPoint& p3)
 {
+   COUNT_PREDICATE_STAGE(PF_ORIENT2D, PS_BIGFLOAT);
    bigfloat l1x, l1y, d1, l2x, l2y, d2, l3x, l3y, d3;
    p1.getBigfloatLambda(l1x, l1y, d1);
    p2.getBigfloatLambda(l2x, l2y, d2);
@@ -9715,6 +9853,7 @@ inline int orient2d_indirect_III_bigfloat(const genericPoint& p1, const genericP
 
 inline int orient2d_indirect_III_exact(const genericPoint& p1, const genericPoint& p2, const genericPoint& p3)
 {
+   COUNT_PREDICATE_STAGE(PF_ORIENT2D, PS_EXACT);
  double return_value = NAN;
 #ifdef CHECK_FOR_XYZERFLOWS
    feclearexcept(FE_ALL_EXCEPT);
@@ -9806,6 +9945,7 @@ inline int orient2d_indirect_III(const genericPoint& p1, const genericPoint& p2,
 
 inline int orient3d_indirect_IEEE_interval(const genericPoint& p1, interval_number ax, interval_number ay, interval_number az, interval_number bx, interval_number by, interval_number bz, interval_number cx, interval_number cy, interval_number cz)
 {
+   COUNT_PREDICATE_STAGE(PF_ORIENT3D, PS_INTERVAL);
    interval_number l1x, l1y, l1z, d1;
    if (
    !p1.getIntervalLambda(l1x, l1y, l1z, d1)
@@ -9846,6 +9986,7 @@ inline int orient3d_indirect_IEEE_interval(const genericPoint& p1, interval_numb
 
 inline int orient3d_indirect_IEEE_bigfloat(const genericPoint& p1, bigfloat ax, bigfloat ay, bigfloat az, bigfloat bx, bigfloat by, bigfloat bz, bigfloat cx, bigfloat cy, bigfloat cz)
 {
+   COUNT_PREDICATE_STAGE(PF_ORIENT3D, PS_BIGFLOAT);
    bigfloat l1x, l1y, l1z, d1;
    p1.getBigfloatLambda(l1x, l1y, l1z, d1);
    const bigfloat dcx(d1 * cx);
@@ -9879,6 +10020,7 @@ inline int orient3d_indirect_IEEE_bigfloat(const genericPoint& p1, bigfloat ax,
 
 inline int orient3d_indirect_IEEE_exact(const genericPoint& p1, double ax, double ay, double az, double bx, double by, double bz, double cx, double cy, double cz)
 {
+   COUNT_PREDICATE_STAGE(PF_ORIENT3D, PS_EXACT);
  double return_value = NAN;
 #ifdef CHECK_FOR_XYZERFLOWS
    feclearexcept(FE_ALL_EXCEPT);
@@ -9990,6 +10132,7 @@ inline int orient3d_indirect_IEEE(const genericPoint& p1, double ax, double ay,
 
 inline int orient3d_indirect_IIEE_interval(const genericPoint& p1, const genericPoint& p2, interval_number p3x, interval_number p3y, interval_number p3z, interval_number p4x, interval_number p4y, interval_number p4z)
 {
+   COUNT_PREDICATE_STAGE(PF_ORIENT3D, PS_INTERVAL);
    interval_number l1x, l1y, l1z, d1, l2x, l2y, l2z, d2;
    if (
    !p1.getIntervalLambda(l1x, l1y, l1z, d1)
@@ -10034,6 +10177,7 @@ inline int orient3d_indirect_IIEE_interval(const genericPoint& p1, const generic
 
 inline int orient3d_indirect_IIEE_bigfloat(const genericPoint& p1, const genericPoint& p2, bigfloat p3x, bigfloat p3y, bigfloat p3z, bigfloat p4x, bigfloat p4y, bigfloat p4z)
 {
+   COUNT_PREDICATE_STAGE(PF_ORIENT3D, PS_BIGFLOAT);
    bigfloat l1x, l1y, l1z, d1, l2x, l2y, l2z, d2;
    p1.getBigfloatLambda(l1x, l1y, l1z, d1);
    p2.getBigfloatLambda(l2x, l2y, l2z, d2);
@@ -10071,6 +10215,7 @@ inline int orient3d_indirect_IIEE_bigfloat(const genericPoint& p1, const generic
 
 inline int orient3d_indirect_IIEE_exact(const genericPoint& p1, const genericPoint& p2, double p3x, double p3y, double p3z, double p4x, double p4y, double p4z)
 {
+   COUNT_PREDICATE_STAGE(PF_ORIENT3D, PS_EXACT);
  double return_value = NAN;
 #ifdef CHECK_FOR_XYZERFLOWS
    feclearexcept(FE_ALL_EXCEPT);
@@ -10199,6 +10344,7 @@ inline int orient3d_indirect_IIEE(const genericPoint& p1, const genericPoint& p2
 
 inline int orient3d_indirect_IIIE_interval(const genericPoint& p1, const genericPoint& p2, const genericPoint& p3, interval_number p4x, interval_number p4y, interval_number p4z)
 {
+   COUNT_PREDICATE_STAGE(PF_ORIENT3D, PS_INTERVAL);
    interval_number l1x, l1y, l1z, d1, l2x, l2y, l2z, d2, l3x, l3y, l3z, d3;
    if (
    !p1.getIntervalLambda(l1x, l1y, l1z, d1)
@@ -10247,6 +10393,7 @@ inline int orient3d_indirect_IIIE_interval(const genericPoint& p1, const generic
 
 inline int orient3d_indirect_IIIE_bigfloat(const genericPoint& p1, const genericPoint& p2, const genericPoint& p3, bigfloat p4x, bigfloat p4y, bigfloat p4z)
 {
+   COUNT_PREDICATE_STAGE(PF_ORIENT3D, PS_BIGFLOAT);
    bigfloat l1x, l1y, l1z, d1, l2x, l2y, l2z, d2, l3x, l3y, l3z, d3;
    p1.getBigfloatLambda(l1x, l1y, l1z, d1);
    p2.getBigfloatLambda(l2x, l2y, l2z, d2);
@@ -10288,6 +10435,7 @@ inline int orient3d_indirect_IIIE_bigfloat(const genericPoint& p1, const generic
 
 inline int orient3d_indirect_IIIE_exact(const genericPoint& p1, const genericPoint& p2, const genericPoint& p3, double p4x, double p4y, double p4z)
 {
+   COUNT_PREDICATE_STAGE(PF_ORIENT3D, PS_EXACT);
  double return_value = NAN;
 #ifdef CHECK_FOR_XYZERFLOWS
    feclearexcept(FE_ALL_EXCEPT);
@@ -10433,6 +10581,7 @@ inline int orient3d_indirect_IIIE(const genericPoint& p1, const genericPoint& p2
 
 inline int orient3d_indirect_IIII_interval(const genericPoint& p1, const genericPoint& p2, const genericPoint& p3, const genericPoint& p4)
 {
+   COUNT_PREDICATE_STAGE(PF_ORIENT3D, PS_INTERVAL);
    interval_number l1x, l1y, l1z, d1, l2x, l2y, l2z, d2, l3x, l3y, l3z, d3, l4x, l4y, l4z, d4;
    if (
    !p1.getIntervalLambda(l1x, l1y, l1z, d1)
@@ -10491,6 +10640,7 @@ inline int orient3d_indirect_IIII_interval(const genericPoint& p1, const generic
 
 inline int orient3d_indirect_IIII_bigfloat(const genericPoint& p1, const genericPoint& p2, const genericPoint& p3, const genericPoint& p4)
 {
+   COUNT_PREDICATE_STAGE(PF_ORIENT3D, PS_BIGFLOAT);
    bigfloat l1x, l1y, l1z, d1, l2x, l2y, l2z, d2, l3x, l3y, l3z, d3, l4x, l4y, l4z, d4;
    p1.getBigfloatLambda(l1x, l1y, l1z, d1);
    p2.getBigfloatLambda(l2x, l2y, l2z, d2);
@@ -10542,6 +10692,7 @@ inline int orient3d_indirect_IIII_bigfloat(const genericPoint& p1, const generic
 
 inline int orient3d_indirect_IIII_exact(const genericPoint& p1, const genericPoint& p2, const genericPoint& p3, const genericPoint& p4)
 {
+   COUNT_PREDICATE_STAGE(PF_ORIENT3D, PS_EXACT);
  double return_value = NAN;
 #ifdef CHECK_FOR_XYZERFLOWS
    feclearexcept(FE_ALL_EXCEPT);
@@ -80,17 +80,25 @@ inline void ip_error(const char* msg)
 
 #pragma fenv_access (on)
 
-inline void setFPUModeToRoundUP() { _controlfp(_RC_UP, _MCW_RC); }
-inline void setFPUModeToRoundNEAR() { _controlfp(_RC_NEAR, _MCW_RC); }
+inline void switchFPUModeToRoundUP() { _controlfp(_RC_UP, _MCW_RC); }
+inline void switchFPUModeToRoundNEAR() { _controlfp(_RC_NEAR, _MCW_RC); }
 
 #else
 
 #pragma STDC FENV_ACCESS ON
 
-inline void setFPUModeToRoundUP() { fesetround(FE_UPWARD); }
-inline void setFPUModeToRoundNEAR() { fesetround(FE_TONEAREST); }
+inline void switchFPUModeToRoundUP() { fesetround(FE_UPWARD); }
+inline void switchFPUModeToRoundNEAR() { fesetround(FE_TONEAREST); }
 #endif
 
+// Interval filters bracket their arithmetic with setFPUModeToRoundUP() and setFPUModeToRoundNEAR().
+// While this flag is set (see upwardRoundingScope) the rounding mode is already upward, and the
+// two calls do nothing, so that a sequence of filters costs a single pair of mode switches.
+inline thread_local bool fpu_upward_rounding_scope = false;
+
+inline void setFPUModeToRoundUP() { if (!fpu_upward_rounding_scope) switchFPUModeToRoundUP(); }
+inline void setFPUModeToRoundNEAR() { if (!fpu_upward_rounding_scope) switchFPUModeToRoundNEAR(); }
+
 #ifdef USE_SIMD_INSTRUCTIONS
 
 #ifdef USE_AVX2_INSTRUCTIONS
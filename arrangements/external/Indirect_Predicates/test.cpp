@@ -1,6 +1,7 @@
 #include "implicit_point.h"
 
 //#define TEST_PLAIN_PREDICATES
+//#define TEST_BATCHED_PREDICATES
 
 #ifdef TEST_PLAIN_PREDICATES
 #include <vector>
@@ -172,6 +173,113 @@ int main(int argc, char* argv[])
 	return 0;
 }
 
+#elif defined(TEST_BATCHED_PREDICATES)
+#include <vector>
+#include <algorithm>
+#include <chrono>
+
+// Compares per-call predicates, which switch the rounding mode at each call,
+// with the batched ones, which switch it once per batch.
+
+inline double randomUnitDouble() { return ((double)rand()) / RAND_MAX; }
+
+// Minimum time over a few runs of f, to filter out noise
+template<typename F>
+double bestElapsedSeconds(F f)
+{
+	double best = 1e30;
+	for (int r = 0; r < 5; r++)
+	{
+		const std::chrono::time_point<std::chrono::steady_clock> c_start = std::chrono::steady_clock::now();
+		f();
+		best = std::min(best, std::chrono::duration<double>(std::chrono::steady_clock::now() - c_start).count());
+	}
+	return best;
+}
+
+void testBatchedPredicates(int num_tuples, int batch_size)
+{
+	// Random segments crossing random triangles: the crossing points are LPIs
+	std::vector<explicitPoint3D> ep;
+	ep.reserve(num_tuples * 5);
+	for (int i = 0; i < num_tuples * 5; i++) ep.push_back(explicitPoint3D(randomUnitDouble(), randomUnitDouble(), randomUnitDouble()));
+
+	std::vector<implicitPoint3D_LPI> ip;
+	ip.reserve(num_tuples);
+	for (int i = 0; i < num_tuples; i++) ip.push_back(implicitPoint3D_LPI(ep[i * 5], ep[i * 5 + 1], ep[i * 5 + 2], ep[i * 5 + 3], ep[i * 5 + 4]));
+
+	// Tuples mixing implicit and explicit points
+	std::vector<const genericPoint*> a(num_tuples), b(num_tuples), c(num_tuples), d(num_tuples);
+	for (int i = 0; i < num_tuples; i++)
+	{
+		a[i] = &ip[i];
+		b[i] = &ip[(i + 1) % num_tuples];
+		c[i] = &ep[(i * 7) % ep.size()];
+		d[i] = &ep[(i * 13 + 1) % ep.size()];
+	}
+
+	std::vector<int> res_call(num_tuples), res_batch(num_tuples);
+	double t_call, t_batch;
+
+	std::cout << num_tuples << " tuples, batches of " << batch_size << "\n";
+
+	t_call = bestElapsedSeconds([&]() {
+		for (int i = 0; i < num_tuples; i++) res_call[i] = genericPoint::orient2Dxy(*a[i], *b[i], *c[i]);
+	});
+	t_batch = bestElapsedSeconds([&]() {
+		for (int i = 0; i < num_tuples; i += batch_size)
+			genericPoint::orient2DxyBatch(&a[i], &b[i], &c[i], &res_batch[i], std::min(batch_size, num_tuples - i));
+	});
+	std::cout << "orient2Dxy  per-call: " << t_call << "s  batched: " << t_batch << "s  " << ((res_call == res_batch) ? "same results" : "DIFFERENT RESULTS") << "\n";
+
+	t_call = bestElapsedSeconds([&]() {
+		for (int i = 0; i < num_tuples; i++) res_call[i] = genericPoint::orient3D(*a[i], *b[i], *c[i], *d[i]);
+	});
+	t_batch = bestElapsedSeconds([&]() {
+		for (int i = 0; i < num_tuples; i += batch_size)
+			genericPoint::orient3DBatch(&a[i], &b[i], &c[i], &d[i], &res_batch[i], std::min(batch_size, num_tuples - i));
+	});
+	std::cout << "orient3D    per-call: " << t_call << "s  batched: " << t_batch << "s  " << ((res_call == res_batch) ? "same results" : "DIFFERENT RESULTS") << "\n";
+
+	t_call = bestElapsedSeconds([&]() {
+		for (int i = 0; i < num_tuples; i++) res_call[i] = genericPoint::lessThan(*a[i], *b[i]);
+	});
+	t_batch = bestElapsedSeconds([&]() {
+		for (int i = 0; i < num_tuples; i += batch_size)
+			genericPoint::lessThanBatch(&a[i], &b[i], &res_batch[i], std::min(batch_size, num_tuples - i));
+	});
+	std::cout << "lessThan    per-call: " << t_call << "s  batched: " << t_batch << "s  " << ((res_call == res_batch) ? "same results" : "DIFFERENT RESULTS") << "\n";
+
+	// Explicit tuples, scalar filter vs four-wide filter
+	std::vector<const double*> ea(num_tuples), eb(num_tuples), ec(num_tuples), ed(num_tuples);
+	for (int i = 0; i < num_tuples; i++)
+	{
+		ea[i] = ep[i * 5].ptr();
+		eb[i] = ep[i * 5 + 1].ptr();
+		ec[i] = ep[i * 5 + 2].ptr();
+		ed[i] = ep[i * 5 + 3].ptr();
+	}
+
+	t_call = bestElapsedSeconds([&]() {
+		for (int i = 0; i < num_tuples; i++) res_call[i] = orient3d(ea[i][0], ea[i][1], ea[i][2], eb[i][0], eb[i][1], eb[i][2], ec[i][0], ec[i][1], ec[i][2], ed[i][0], ed[i][1], ed[i][2]);
+	});
+	t_batch = bestElapsedSeconds([&]() {
+		for (int i = 0; i < num_tuples; i += batch_size)
+			orient3dBatch(&ea[i], &eb[i], &ec[i], &ed[i], &res_batch[i], std::min(batch_size, num_tuples - i));
+	});
+	std::cout << "orient3d    per-call: " << t_call << "s  batched: " << t_batch << "s  " << ((res_call == res_batch) ? "same results" : "DIFFERENT RESULTS") << "\n";
+}
+
+int main(int argc, char* argv[])
+{
+	initFPU();
+
+	testBatchedPredicates(1000000, 3);
+	testBatchedPredicates(1000000, 64);
+
+	return 0;
+}
+
 #else
 
 int main(int argc, char *argv[])
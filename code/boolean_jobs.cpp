@@ -0,0 +1,246 @@
+/*****************************************************************************************
+ *              MIT License                                                              *
+ *                                                                                       *
+ * Copyright (c) 2022 G. Cherchi, F. Pellacini, M. Attene and M. Livesu                  *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION     *
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        *
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                *
+ *                                                                                       *
+ * Authors:                                                                              *
+ *      Gianmarco Cherchi (g.cherchi@unica.it)                                           *
+ *      https://www.gianmarcocherchi.com                                                 *
+ *                                                                                       *
+ *      Fabio Pellacini (fabio.pellacini@uniroma1.it)                                    *
+ *      https://pellacini.di.uniroma1.it                                                 *
+ *                                                                                       *
+ *      Marco Attene (marco.attene@ge.imati.cnr.it)                                      *
+ *      https://www.cnr.it/en/people/marco.attene/                                       *
+ *                                                                                       *
+ *      Marco Livesu (marco.livesu@ge.imati.cnr.it)                                      *
+ *      http://pers.ge.imati.cnr.it/livesu/                                              *
+ *                                                                                       *
+ * ***************************************************************************************/
+
+#include "boolean_jobs.h"
+
+BooleanJobQueue::BooleanJobQueue(uint max_in_flight, const ParallelConfig &parallel)
+    : max_in_flight(std::max(max_in_flight, 1u)), parallel(parallel)
+{
+    loader   = std::thread(&BooleanJobQueue::loadStage,    this);
+    computer = std::thread(&BooleanJobQueue::computeStage, this);
+    writer   = std::thread(&BooleanJobQueue::writeStage,   this);
+}
+
+BooleanJobQueue::~BooleanJobQueue()
+{
+    // each stage drains its channel before closing the next one
+    to_load.close();
+    loader.join();
+    to_compute.close();
+    computer.join();
+    to_write.close();
+    writer.join();
+}
+
+//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+std::future<BooleanJobResult> BooleanJobQueue::submit(BooleanJob job)
+{
+    std::unique_ptr<Entry> e = std::make_unique<Entry>();
+    e->job = std::move(job);
+    std::future<BooleanJobResult> f = e->promise.get_future();
+
+    {
+        std::lock_guard<std::mutex> lock(slots_mutex);
+        pending++;
+    }
+
+    to_load.push(std::move(e));
+    return f;
+}
+
+void BooleanJobQueue::waitAll()
+{
+    std::unique_lock<std::mutex> lock(slots_mutex);
+    slots_cv.wait(lock, [this]() { return pending == 0; });
+}
+
+//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+void BooleanJobQueue::acquireSlot()
+{
+    std::unique_lock<std::mutex> lock(slots_mutex);
+    slots_cv.wait(lock, [this]() { return in_flight < max_in_flight; });
+    in_flight++;
+}
+
+void BooleanJobQueue::releaseSlot()
+{
+    {
+        std::lock_guard<std::mutex> lock(slots_mutex);
+        in_flight--;
+        pending--;
+    }
+    slots_cv.notify_all();
+}
+
+//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+void BooleanJobQueue::loadStage()
+{
+    std::unique_ptr<Entry> e;
+    while(to_load.pop(e))
+    {
+        acquireSlot();
+
+        try
+        {
+            BooleanJob &job = e->job;
+            auto start = std::chrono::steady_clock::now();
+
+            if(!job.in_files.empty())
+            {
+                job.in_coords.clear();
+                job.in_tris.clear();
+                job.in_labels.clear();
+                // in the arena of the pipeline, so that the parsing stays within its concurrency bound
+                parallel.execute([&]()
+                {
+                    loadMultipleFiles(job.in_files, job.in_coords, job.in_tris, job.in_labels, parallel.parallel());
+                });
+            }
+
+            e->res.load_time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        }
+        catch(...)
+        {
+            e->promise.set_exception(std::current_exception());
+            releaseSlot();
+            continue;
+        }
+
+        to_compute.push(std::move(e));
+    }
+}
+
+void BooleanJobQueue::computeStage()
+{
+    std::unique_ptr<Entry> e;
+    while(to_compute.pop(e))
+    {
+        try
+        {
+            BooleanJob &job = e->job;
+            if(job.stream_output && !job.out_file.empty())
+            {
+                std::unique_ptr<MeshSink> sink = makeFileSink(job.out_file, parallel.parallel());
+                e->res.stats = booleanPipeline(job.in_coords, job.in_tris, job.in_labels, job.op, *sink,
+                                               job.engine, parallel, job.cancel);
+            }
+            else e->res.stats = booleanPipeline(job.in_coords, job.in_tris, job.in_labels, job.op,
+                                                e->res.coords, e->res.tris, e->res.labels,
+                                                job.engine, parallel, job.cancel);
+
+            // the input is not needed anymore
+            std::vector<double>().swap(job.in_coords);
+            std::vector<uint>().swap(job.in_tris);
+            std::vector<uint>().swap(job.in_labels);
+        }
+        catch(...)
+        {
+            e->promise.set_exception(std::current_exception());
+            releaseSlot();
+            continue;
+        }
+
+        to_write.push(std::move(e));
+    }
+}
+
+void BooleanJobQueue::writeStage()
+{
+    std::unique_ptr<Entry> e;
+    while(to_write.pop(e))
+    {
+        try
+        {
+            BooleanJob &job = e->job;
+            BooleanJobResult &res = e->res;
+            auto start = std::chrono::steady_clock::now();
+
+            if(!job.out_file.empty() && !job.stream_output && res.stats.status == PIPELINE_COMPLETED)
+            {
+                // same text of cinolib::write_OBJ, which exits on I/O errors instead of throwing
+                uint num_verts = static_cast<uint>(res.coords.size() / 3);
+                uint num_tris = static_cast<uint>(res.tris.size() / 3);
+                OBJSink sink(job.out_file, false);
+                sink.begin(num_verts, num_tris);
+                sink.vertices(res.coords.data(), num_verts);
+                sink.triangles(res.tris.data(), res.labels.data(), num_tris);
+                sink.end();
+            }
+
+            res.write_time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+            if(!job.keep_output)
+            {
+                std::vector<double>().swap(res.coords);
+                std::vector<uint>().swap(res.tris);
+                std::vector<std::bitset<NBIT>>().swap(res.labels);
+            }
+
+            e->promise.set_value(std::move(res));
+        }
+        catch(...)
+        {
+            e->promise.set_exception(std::current_exception());
+        }
+
+        releaseSlot();
+    }
+}
+
+//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+void BooleanJobQueue::Channel::push(std::unique_ptr<Entry> e)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        queue.push_back(std::move(e));
+    }
+    cv.notify_one();
+}
+
+bool BooleanJobQueue::Channel::pop(std::unique_ptr<Entry> &e)
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    cv.wait(lock, [this]() { return closed || !queue.empty(); });
+    if(queue.empty()) return false;
+
+    e = std::move(queue.front());
+    queue.pop_front();
+    return true;
+}
+
+void BooleanJobQueue::Channel::close()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        closed = true;
+    }
+    cv.notify_all();
+}
@@ -0,0 +1,150 @@
+/*****************************************************************************************
+ *              MIT License                                                              *
+ *                                                                                       *
+ * Copyright (c) 2022 G. Cherchi, F. Pellacini, M. Attene and M. Livesu                  *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION     *
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        *
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                *
+ *                                                                                       *
+ * Authors:                                                                              *
+ *      Gianmarco Cherchi (g.cherchi@unica.it)                                           *
+ *      https://www.gianmarcocherchi.com                                                 *
+ *                                                                                       *
+ *      Fabio Pellacini (fabio.pellacini@uniroma1.it)                                    *
+ *      https://pellacini.di.uniroma1.it                                                 *
+ *                                                                                       *
+ *      Marco Attene (marco.attene@ge.imati.cnr.it)                                      *
+ *      https://www.cnr.it/en/people/marco.attene/                                       *
+ *                                                                                       *
+ *      Marco Livesu (marco.livesu@ge.imati.cnr.it)                                      *
+ *      http://pers.ge.imati.cnr.it/livesu/                                              *
+ *                                                                                       *
+ * ***************************************************************************************/
+
+#ifndef BOOLEAN_JOBS_H
+#define BOOLEAN_JOBS_H
+
+#include "booleans.h"
+
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+// A boolean job: load the input meshes, run booleanPipeline, write the result.
+// The input is either read from in_files (as in loadMultipleFiles) or, if in_files is empty,
+// taken from in_coords/in_tris/in_labels.
+struct BooleanJob
+{
+    std::vector<std::string> in_files;
+    std::vector<double>      in_coords;
+    std::vector<uint>        in_tris;
+    std::vector<uint>        in_labels;
+
+    BoolSelection            op           = UNION;
+    TriangulationEngine      engine       = SPLIT_AND_WALK;
+    const CancellationToken *cancel       = nullptr;
+
+    std::string              out_file;              // written in OBJ format (OBJSink), if not empty
+    bool                     keep_output  = true;   // if false, the result mesh is freed once written
+
+    // if set (and out_file is not empty), the result is written by the compute stage while it is produced,
+    // in the format of the extension of out_file (see makeFileSink), and it is never stored: the result
+    // vectors stay empty and the writing time is part of the OUTPUT phase of the stats
+    bool                     stream_output = false;
+};
+
+struct BooleanJobResult
+{
+    std::vector<double>            coords;
+    std::vector<uint>              tris;
+    std::vector<std::bitset<NBIT>> labels;
+
+    PipelineStats stats;
+    double        load_time  = 0.0;   // in seconds
+    double        write_time = 0.0;
+};
+
+// Runs a sequence of boolean jobs asynchronously, in three pipelined stages, each on its own thread:
+// the parsing of job N+1 and writing of job N-1 overlap with the compute of job N. Parsing and compute
+// run as set by the ParallelConfig of the queue, writing is serial.
+// At most max_in_flight jobs are between the start of their loading and the end of their writing,
+// which bounds the memory held by inputs and outputs waiting for the next stage.
+// Jobs are processed in submission order. Errors (unreadable input, unsupported output format, I/O
+// errors, an empty BoolSelection rule) are thrown by the stages and reported
+// through the future of the job; a cancelled job completes with the status in its stats.
+class BooleanJobQueue
+{
+    public:
+
+        explicit BooleanJobQueue(uint max_in_flight = 3, const ParallelConfig &parallel = ParallelConfig());
+
+        // waits for all the submitted jobs
+        ~BooleanJobQueue();
+
+        std::future<BooleanJobResult> submit(BooleanJob job);
+
+        // blocks until all the jobs submitted so far are done
+        void waitAll();
+
+    private:
+
+        struct Entry
+        {
+            BooleanJob                     job;
+            BooleanJobResult               res;
+            std::promise<BooleanJobResult> promise;
+        };
+
+        // blocking FIFO between two stages, pop returns false once closed and empty
+        class Channel
+        {
+            public:
+                void push(std::unique_ptr<Entry> e);
+                bool pop(std::unique_ptr<Entry> &e);
+                void close();
+
+            private:
+                std::mutex                         mutex;
+                std::condition_variable            cv;
+                std::deque<std::unique_ptr<Entry>> queue;
+                bool                               closed = false;
+        };
+
+        void loadStage();
+        void computeStage();
+        void writeStage();
+
+        void acquireSlot();
+        void releaseSlot(); // job done (either completed or failed)
+
+        uint           max_in_flight;
+        ParallelConfig parallel;
+
+        Channel to_load, to_compute, to_write;
+
+        std::mutex              slots_mutex;
+        std::condition_variable slots_cv;
+        uint                    in_flight = 0;   // loading, loaded, computing or writing
+        uint                    pending   = 0;   // submitted and not done yet
+
+        std::thread loader, computer, writer;
+};
+
+#endif // BOOLEAN_JOBS_H
@@ -38,68 +38,457 @@
 #include "debug.h"
 #include "io_functions.h"
 #include <tbb/tbb.h>
+#include <stdexcept>
 
-void customBooleanPipeline(std::vector<genericPoint*>& arr_verts, std::vector<uint>& arr_in_tris,
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+bool customBooleanPipeline(std::vector<genericPoint*>& arr_verts, std::vector<uint>& arr_in_tris,
                                   std::vector<uint>& arr_out_tris, std::vector<std::bitset<NBIT>>& arr_in_labels,
                                   std::vector<DuplTriInfo>& dupl_triangles, Labels& labels,
                                   std::vector<phmap::flat_hash_set<uint>>& patches, cinolib::Octree& octree,
-                                  const BoolOp &op, std::vector<double> &bool_coords, std::vector<uint> &bool_tris,
-                                  std::vector< std::bitset<NBIT>> &bool_labels)
+                                  const BoolSelection &op, std::vector<double> &bool_coords, std::vector<uint> &bool_tris,
+                                  std::vector< std::bitset<NBIT>> &bool_labels, PipelineStats *stats,
+                                  bool parallel, const CancellationToken *cancel)
 {
-    FastTrimesh tm(arr_verts, arr_out_tris, true);
+    if(stats) stats->beginPhase();
+    FastTrimesh tm(arr_verts, arr_out_tris, parallel);
+
+    uint num_tris_in_final_solution;
+    if(!customBooleanSelection(arr_verts, arr_in_tris, arr_in_labels, dupl_triangles, labels, patches, octree, op,
+                               tm, num_tris_in_final_solution, stats, parallel, cancel)) return false;
+
+    if(stats) stats->beginPhase();
+    computeFinalExplicitResult(tm, labels, num_tris_in_final_solution, bool_coords, bool_tris, bool_labels, true, parallel);
+    if(stats) stats->endPhase(PipelineStats::OUTPUT);
+
+    return true;
+}
+
+//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+bool customBooleanSelection(std::vector<genericPoint*>& arr_verts, std::vector<uint>& arr_in_tris,
+                            std::vector<std::bitset<NBIT>>& arr_in_labels,
+                            std::vector<DuplTriInfo>& dupl_triangles, Labels& labels,
+                            std::vector<phmap::flat_hash_set<uint>>& patches, cinolib::Octree& octree,
+                            const BoolSelection &op, FastTrimesh &tm, uint &num_tris_in_final_solution, PipelineStats *stats,
+                            bool parallel, const CancellationToken *cancel)
+{
+    if(!customPatchLabelling(arr_verts, arr_in_tris, arr_in_labels, dupl_triangles, labels, patches, octree, tm, stats,
+                             parallel, cancel)) return false;
+
+    if(stats) stats->beginPhase();
 
-    computeAllPatches(tm, labels, patches, true);
+    // booleand operations
+    num_tris_in_final_solution = selectTriangles(tm, labels, op, parallel);
+
+    if(stats) stats->endPhase(PipelineStats::SELECTION);
+
+    return true;
+}
+
+//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+bool customPatchLabelling(std::vector<genericPoint*>& arr_verts, std::vector<uint>& arr_in_tris,
+                          std::vector<std::bitset<NBIT>>& arr_in_labels,
+                          std::vector<DuplTriInfo>& dupl_triangles, Labels& labels,
+                          std::vector<phmap::flat_hash_set<uint>>& patches, cinolib::Octree& octree,
+                          FastTrimesh &tm, PipelineStats *stats, bool parallel, const CancellationToken *cancel)
+{
+    computeAllPatches(tm, labels, patches, parallel);
+    if(stats)
+    {
+        stats->num_patches = static_cast<uint>(patches.size());
+        stats->endPhase(PipelineStats::PATCHES);
+        stats->beginPhase();
+    }
+    if(stopRequested(cancel)) return false;
 
     // the informations about duplicated triangles (removed in arrangements) are restored in the original structures
     addDuplicateTrisInfoInStructures(dupl_triangles, arr_in_tris, arr_in_labels, octree);
 
     // parse patches with octree and rays
     cinolib::vec3d max_coords(octree.root->bbox.max.x() +0.5, octree.root->bbox.max.y() +0.5, octree.root->bbox.max.z() +0.5);
-    computeInsideOut(tm, patches, octree, arr_verts, arr_in_tris, arr_in_labels, max_coords, labels);
+    computeInsideOut(tm, patches, octree, arr_verts, arr_in_tris, arr_in_labels, max_coords, labels, stats, cancel);
+    if(stats) stats->endPhase(PipelineStats::INSIDE_OUT);
 
-    // booleand operations
-    uint num_tris_in_final_solution;
-    if(op == INTERSECTION)
-        num_tris_in_final_solution = boolIntersection(tm, labels);
-    else if(op == UNION)
-        num_tris_in_final_solution = boolUnion(tm, labels);
-    else if(op == SUBTRACTION)
-        num_tris_in_final_solution = boolSubtraction(tm, labels);
-    else if(op == XOR)
-        num_tris_in_final_solution = boolXOR(tm, labels);
-    else
+    return !stopRequested(cancel);
+}
+
+extern std::vector<std::string> files;
+
+PipelineStats booleanPipeline(const std::vector<double> &in_coords, const std::vector<uint> &in_tris,
+                            const std::vector<uint> &in_labels, const BoolSelection &op, std::vector<double> &bool_coords,
+                            std::vector<uint> &bool_tris, std::vector< std::bitset<NBIT> > &bool_labels,
+                            TriangulationEngine engine, const ParallelConfig &parallel, const CancellationToken *cancel)
+{
+    PipelineStats stats;
+
+    parallel.execute([&]()
     {
-        std::cerr << "boolean operation not implemented yet" << std::endl;
-        std::exit(EXIT_FAILURE);
-    }
+        initFPU();
+        const PredicateStats predicates_start = predicateStageCounters::collect();
+
+        point_arena arena;
+        std::vector<genericPoint*> arr_verts; // <- it contains the original expl verts + the new_impl verts
+        std::vector<uint> arr_in_tris, arr_out_tris;
+        std::vector<std::bitset<NBIT>> arr_in_labels;
+        std::vector<DuplTriInfo> dupl_triangles;
+        Labels labels;
+        std::vector<phmap::flat_hash_set<uint>> patches;
+        cinolib::Octree octree; // built with arr_in_tris and arr_in_labels
+
+        bool completed = customArrangementPipeline(in_coords, in_tris, in_labels, arr_in_tris, arr_in_labels, arena, arr_verts,
+                                                   arr_out_tris, labels, octree, dupl_triangles, engine, &stats,
+                                                   parallel.parallel(), cancel, parallel.schedule) &&
+                         customBooleanPipeline(arr_verts, arr_in_tris, arr_out_tris, arr_in_labels, dupl_triangles, labels,
+                                               patches, octree, op, bool_coords, bool_tris, bool_labels, &stats,
+                                               parallel.parallel(), cancel);
+
+        stats.predicates = predicateStageCounters::collectSince(predicates_start);
+
+        if(!completed)
+        {
+            stats.status = cancel->status();
+            bool_coords.clear();
+            bool_tris.clear();
+            bool_labels.clear();
+        }
+    });
 
-    computeFinalExplicitResult(tm, labels, num_tris_in_final_solution, bool_coords, bool_tris, bool_labels, true);
+    return stats;
 }
 
-extern int arr_time;
-extern int bool_time;
-extern std::vector<std::string> files;
+//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
-void booleanPipeline(const std::vector<double> &in_coords, const std::vector<uint> &in_tris,
-                            const std::vector<uint> &in_labels, const BoolOp &op, std::vector<double> &bool_coords,
-                            std::vector<uint> &bool_tris, std::vector< std::bitset<NBIT> > &bool_labels)
+PipelineStats booleanPipeline(const std::vector<double> &in_coords, const std::vector<uint> &in_tris,
+                            const std::vector<uint> &in_labels, const BoolSelection &op, MeshSink &sink,
+                            TriangulationEngine engine, const ParallelConfig &parallel, const CancellationToken *cancel)
 {
-    initFPU();
+    PipelineStats stats;
+
+    parallel.execute([&]()
+    {
+        initFPU();
+        const PredicateStats predicates_start = predicateStageCounters::collect();
+
+        point_arena arena;
+        std::vector<genericPoint*> arr_verts;
+        std::vector<uint> arr_in_tris, arr_out_tris;
+        std::vector<std::bitset<NBIT>> arr_in_labels;
+        std::vector<DuplTriInfo> dupl_triangles;
+        Labels labels;
+        std::vector<phmap::flat_hash_set<uint>> patches;
+        cinolib::Octree octree;
+
+        bool completed = customArrangementPipeline(in_coords, in_tris, in_labels, arr_in_tris, arr_in_labels, arena, arr_verts,
+                                                   arr_out_tris, labels, octree, dupl_triangles, engine, &stats,
+                                                   parallel.parallel(), cancel, parallel.schedule);
+        if(completed)
+        {
+            stats.beginPhase();
+            FastTrimesh tm(arr_verts, arr_out_tris, parallel.parallel());
+
+            uint num_tris_in_final_solution;
+            completed = customBooleanSelection(arr_verts, arr_in_tris, arr_in_labels, dupl_triangles, labels, patches, octree, op,
+                                               tm, num_tris_in_final_solution, &stats, parallel.parallel(), cancel);
+            if(completed)
+            {
+                stats.beginPhase();
+                streamFinalExplicitResult(tm, labels, sink, parallel.parallel());
+                stats.endPhase(PipelineStats::OUTPUT);
+            }
+        }
+
+        stats.predicates = predicateStageCounters::collectSince(predicates_start);
+
+        if(!completed) stats.status = cancel->status();
+    });
+
+    return stats;
+}
+
+//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+PipelineStats arrangementPipeline(const std::vector<double> &in_coords, const std::vector<uint> &in_tris,
+                                  const std::vector<uint> &in_labels, LabelledArrangement &arr,
+                                  TriangulationEngine engine, const ParallelConfig &parallel, const CancellationToken *cancel)
+{
+    PipelineStats stats;
+
+    parallel.execute([&]()
+    {
+        initFPU();
+        const PredicateStats predicates_start = predicateStageCounters::collect();
+
+        arr.arena = std::make_unique<point_arena>();
+        arr.tm = FastTrimesh();
+        arr.labels = Labels();
+
+        std::vector<genericPoint*> arr_verts;
+        std::vector<uint> arr_in_tris, arr_out_tris;
+        std::vector<std::bitset<NBIT>> arr_in_labels;
+        std::vector<DuplTriInfo> dupl_triangles;
+        std::vector<phmap::flat_hash_set<uint>> patches;
+        cinolib::Octree octree;
+
+        bool completed = customArrangementPipeline(in_coords, in_tris, in_labels, arr_in_tris, arr_in_labels, *arr.arena, arr_verts,
+                                                   arr_out_tris, arr.labels, octree, dupl_triangles, engine, &stats,
+                                                   parallel.parallel(), cancel, parallel.schedule);
+        if(completed)
+        {
+            stats.beginPhase();
+            arr.tm = FastTrimesh(arr_verts, arr_out_tris, parallel.parallel());
+            completed = customPatchLabelling(arr_verts, arr_in_tris, arr_in_labels, dupl_triangles, arr.labels, patches, octree,
+                                             arr.tm, &stats, parallel.parallel(), cancel);
+        }
+
+        stats.predicates = predicateStageCounters::collectSince(predicates_start);
+
+        if(!completed)
+        {
+            stats.status = cancel->status();
+            arr.tm = FastTrimesh();
+            arr.labels = Labels();
+        }
+    });
+
+    return stats;
+}
+
+//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
-    point_arena arena;
-    std::vector<genericPoint*> arr_verts; // <- it contains the original expl verts + the new_impl verts
-    std::vector<uint> arr_in_tris, arr_out_tris;
-    std::vector<std::bitset<NBIT>> arr_in_labels;
-    std::vector<DuplTriInfo> dupl_triangles;
-    Labels labels;
-    std::vector<phmap::flat_hash_set<uint>> patches;
-    cinolib::Octree octree; // built with arr_in_tris and arr_in_labels
+PipelineStats selectBoolean(LabelledArrangement &arr, const BoolSelection &op, std::vector<double> &bool_coords,
+                            std::vector<uint> &bool_tris, std::vector<std::bitset<NBIT>> &bool_labels,
+                            const ParallelConfig &parallel)
+{
+    if(arr.tm.numVerts() == 0) throw std::invalid_argument("selectBoolean() : the arrangement was not built");
+
+    PipelineStats stats;
 
-    customArrangementPipeline(in_coords, in_tris, in_labels, arr_in_tris, arr_in_labels, arena, arr_verts,
-                              arr_out_tris, labels, octree, dupl_triangles);
+    parallel.execute([&]()
+    {
+        initFPU();
 
-    customBooleanPipeline(arr_verts, arr_in_tris, arr_out_tris, arr_in_labels, dupl_triangles, labels,
-                          patches, octree, op, bool_coords, bool_tris, bool_labels);
+        stats.beginPhase();
+        uint num_tris_in_final_solution = selectTriangles(arr.tm, arr.labels, op, parallel.parallel());
+        stats.endPhase(PipelineStats::SELECTION);
+
+        stats.beginPhase();
+        computeFinalExplicitResult(arr.tm, arr.labels, num_tris_in_final_solution, bool_coords, bool_tris, bool_labels, true,
+                                   parallel.parallel());
+        stats.endPhase(PipelineStats::OUTPUT);
+    });
+
+    return stats;
+}
+
+//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+PipelineStats selectBoolean(LabelledArrangement &arr, const BoolSelection &op, MeshSink &sink, const ParallelConfig &parallel)
+{
+    if(arr.tm.numVerts() == 0) throw std::invalid_argument("selectBoolean() : the arrangement was not built");
+
+    PipelineStats stats;
+
+    parallel.execute([&]()
+    {
+        initFPU();
+
+        stats.beginPhase();
+        selectTriangles(arr.tm, arr.labels, op, parallel.parallel());
+        stats.endPhase(PipelineStats::SELECTION);
+
+        stats.beginPhase();
+        streamFinalExplicitResult(arr.tm, arr.labels, sink, parallel.parallel());
+        stats.endPhase(PipelineStats::OUTPUT);
+    });
+
+    return stats;
+}
+
+//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+PipelineStats chainedBooleanPipeline(const ImplicitResult &prev, const std::vector<double> &in_coords,
+                                     const std::vector<uint> &in_tris, const std::vector<uint> &in_labels,
+                                     const BoolSelection &op, ImplicitResult &result,
+                                     TriangulationEngine engine, const ParallelConfig &parallel, const CancellationToken *cancel)
+{
+    PipelineStats stats;
+
+    parallel.execute([&]()
+    {
+        initFPU();
+        const PredicateStats predicates_start = predicateStageCounters::collect();
+
+        // prev is read before result is reset, since they can be the same object
+        std::vector<double> coords;
+        std::vector<uint> tris, labels_in;
+        stats.num_rounded_verts = appendImplicitResult(prev, 0, coords, tris, labels_in, parallel.parallel());
+
+        uint v_off = static_cast<uint>(coords.size() / 3);
+        uint l_off = (prev.tris.empty()) ? 0 : 1;
+        coords.insert(coords.end(), in_coords.begin(), in_coords.end());
+        for(uint v_id : in_tris) tris.push_back(v_id + v_off);
+        for(uint l : in_labels) labels_in.push_back(l + l_off);
+
+        result.arena = std::make_unique<point_arena>();
+        result.verts.clear();
+        result.tris.clear();
+        result.labels.clear();
+
+        std::vector<uint> arr_in_tris, arr_out_tris;
+        std::vector<std::bitset<NBIT>> arr_in_labels;
+        std::vector<DuplTriInfo> dupl_triangles;
+        Labels labels;
+        std::vector<phmap::flat_hash_set<uint>> patches;
+        cinolib::Octree octree;
+        std::vector<genericPoint*> arr_verts;
+
+        bool completed = customArrangementPipeline(coords, tris, labels_in, arr_in_tris, arr_in_labels, *result.arena, arr_verts,
+                                                   arr_out_tris, labels, octree, dupl_triangles, engine, &stats,
+                                                   parallel.parallel(), cancel, parallel.schedule);
+        if(completed)
+        {
+            stats.beginPhase();
+            FastTrimesh tm(arr_verts, arr_out_tris, parallel.parallel());
+
+            uint num_tris_in_final_solution;
+            completed = customBooleanSelection(arr_verts, arr_in_tris, arr_in_labels, dupl_triangles, labels, patches, octree, op,
+                                               tm, num_tris_in_final_solution, &stats, parallel.parallel(), cancel);
+            if(completed)
+            {
+                stats.beginPhase();
+                computeFinalImplicitResult(tm, labels, num_tris_in_final_solution, result.verts, result.tris, result.labels);
+                stats.endPhase(PipelineStats::OUTPUT);
+            }
+        }
+
+        stats.predicates = predicateStageCounters::collectSince(predicates_start);
+
+        if(!completed)
+        {
+            stats.status = cancel->status();
+            result.verts.clear();
+            result.tris.clear();
+            result.labels.clear();
+        }
+    });
+
+    return stats;
+}
+
+//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+uint appendImplicitResult(const ImplicitResult &res, uint label, std::vector<double> &coords, std::vector<uint> &tris,
+                          std::vector<uint> &labels, bool parallel)
+{
+    if(res.verts.empty()) return 0;
+
+    uint num_verts = static_cast<uint>(res.verts.size()) - 1; // the last one is (multiplier, 0, 0)
+    double multiplier = res.verts.back()->toExplicit3D().X();
+
+    size_t c_off = coords.size();
+    uint v_off = static_cast<uint>(c_off / 3);
+    coords.resize(c_off + 3 * static_cast<size_t>(num_verts));
+
+    // the multiplier is a power of two: scaling back the explicit vertices is exact, and the implicit ones
+    // stay exact if they fall on a double. The others are rounded as precisely as possible (from the exact
+    // lambdas), instead of the quick approximation of computeFinalExplicitResult
+    std::atomic<uint> num_rounded(0);
+
+    auto convert = [&](uint v_id)
+    {
+        const genericPoint *v = res.verts[v_id];
+        double *c = coords.data() + c_off + 3 * static_cast<size_t>(v_id);
+
+        if(v->isExplicit3D())
+        {
+            const explicitPoint3D &e = v->toExplicit3D();
+            c[0] = e.X(); c[1] = e.Y(); c[2] = e.Z();
+        }
+        else
+        {
+            v->getApproxXYZCoordinates(c[0], c[1], c[2]);
+            explicitPoint3D rounded(c[0], c[1], c[2]);
+            if(genericPoint::lessThan(*v, rounded) != 0)
+            {
+                v->getApproxXYZCoordinates(c[0], c[1], c[2], true);
+                num_rounded++;
+            }
+        }
+
+        for(uint i = 0; i < 3; i++) c[i] /= multiplier;
+    };
+
+    if(parallel) tbb::parallel_for((uint)0, num_verts, convert);
+    else for(uint v_id = 0; v_id < num_verts; v_id++) convert(v_id);
+
+    for(uint v_id : res.tris) tris.push_back(v_id + v_off);
+    labels.insert(labels.end(), res.tris.size() / 3, label);
+
+    return num_rounded;
+}
+
+//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+void implicitResultToExplicit(const ImplicitResult &res, std::vector<double> &coords, std::vector<uint> &tris,
+                              std::vector<std::bitset<NBIT>> &labels, bool parallel)
+{
+    std::vector<uint> tmp_labels;
+    coords.clear();
+    tris.clear();
+    appendImplicitResult(res, 0, coords, tris, tmp_labels, parallel);
+    labels = res.labels;
+}
+
+//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+const char *PipelineStats::phaseName(int p)
+{
+    static const char *names[NUM_PHASES] = {"merge", "dedup", "soup_init", "octree", "detection", "classification",
+                                            "triangulation", "patches", "inside_out", "selection", "output"};
+    return names[p];
+}
+
+void PipelineStats::beginPhase()
+{
+    phase_start_rss = peakResidentSetSize();
+    phase_start = std::chrono::steady_clock::now();
+}
+
+void PipelineStats::endPhase(Phase p, point_arena *arena)
+{
+    time[p] = std::chrono::duration<double>(std::chrono::steady_clock::now() - phase_start).count();
+    if(arena)
+    {
+        arena_peak_bytes[p] = arena->peakBytes();
+        arena->resetPeak();
+    }
+    process_peak_rss_bytes[p] = peakResidentSetSize();
+    peak_rss_growth_bytes[p] = process_peak_rss_bytes[p] - phase_start_rss;
+}
+
+size_t peakResidentSetSize()
+{
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS info;
+    if(!GetProcessMemoryInfo(GetCurrentProcess(), &info, sizeof(info))) return 0;
+    return static_cast<size_t>(info.PeakWorkingSetSize);
+#else
+    struct rusage usage;
+    if(getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+#ifdef __APPLE__
+    return static_cast<size_t>(usage.ru_maxrss); // bytes
+#else
+    return static_cast<size_t>(usage.ru_maxrss) * 1024; // kilobytes
+#endif
+#endif
 }
 
 
@@ -107,10 +496,12 @@ void booleanPipeline(const std::vector<double> &in_coords, const std::vector<uin
 //:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
 /* a custom arrangement pipeline in witch we can expose the octree used to find the starting intersection list */
-void customArrangementPipeline(const std::vector<double> &in_coords, const std::vector<uint> &in_tris, const std::vector<uint> &in_labels,
+bool customArrangementPipeline(const std::vector<double> &in_coords, const std::vector<uint> &in_tris, const std::vector<uint> &in_labels,
                                       std::vector<uint> &arr_in_tris, std::vector< std::bitset<NBIT>> &arr_in_labels,
                                       point_arena& arena, std::vector<genericPoint *> &vertices, std::vector<uint> &arr_out_tris, Labels &labels,
-                                      cinolib::Octree &octree, std::vector<DuplTriInfo> &dupl_triangles)
+                                      cinolib::Octree &octree, std::vector<DuplTriInfo> &dupl_triangles,
+                                      TriangulationEngine engine, PipelineStats *stats,
+                                      bool parallel, const CancellationToken *cancel, TriangulationSchedule schedule)
 {
     arr_in_labels.resize(in_labels.size());
     std::bitset<NBIT> mask;
@@ -124,25 +515,61 @@ void customArrangementPipeline(const std::vector<double> &in_coords, const std::
     labels.num = mask.count();
 
     initFPU();
+    if(stats) stats->beginPhase();
     double multiplier = computeMultiplier(in_coords);
 
-    mergeDuplicatedVertices(in_coords, in_tris, arena, vertices, arr_in_tris, true);
+    mergeDuplicatedVertices(in_coords, in_tris, arena, vertices, arr_in_tris, parallel);
+    if(stats)
+    {
+        stats->endPhase(PipelineStats::MERGE, &arena);
+        stats->beginPhase();
+    }
+    if(stopRequested(cancel)) return false;
 
-    customRemoveDegenerateAndDuplicatedTriangles(vertices, arr_in_tris, arr_in_labels, dupl_triangles, true);
+    customRemoveDegenerateAndDuplicatedTriangles(vertices, arr_in_tris, arr_in_labels, dupl_triangles, parallel);
+    if(stats)
+    {
+        stats->endPhase(PipelineStats::DEDUP, &arena);
+        stats->beginPhase();
+    }
+    if(stopRequested(cancel)) return false;
 
-    TriangleSoup ts(arena, vertices, arr_in_tris, arr_in_labels, multiplier, true);
+    TriangleSoup ts(arena, vertices, arr_in_tris, arr_in_labels, multiplier, parallel);
+    if(stats) stats->endPhase(PipelineStats::SOUP_INIT, &arena);
+    if(stopRequested(cancel)) return false;
 
     AuxiliaryStructure g;
-    customDetectIntersections(ts, g.intersectionList(), octree);
+    customDetectIntersections(ts, g.intersectionList(), octree, stats, cancel); // times both OCTREE and DETECTION
+    if(stats)
+    {
+        stats->num_intersection_pairs = static_cast<uint>(g.intersectionList().size());
+        stats->arena_peak_bytes[PipelineStats::OCTREE] = stats->arena_peak_bytes[PipelineStats::DETECTION] = arena.peakBytes();
+        arena.resetPeak();
+        stats->beginPhase();
+    }
+    if(stopRequested(cancel)) return false;
 
     g.initFromTriangleSoup(ts);
 
     classifyIntersections(ts, arena, g);
+    if(stats)
+    {
+        stats->endPhase(PipelineStats::CLASSIFICATION, &arena);
+        stats->beginPhase();
+    }
+    if(stopRequested(cancel)) return false;
 
-    triangulation(ts, arena, g, arr_out_tris, labels.surface);
+    triangulation(ts, arena, g, arr_out_tris, labels.surface, engine, cancel, schedule, parallel);
     ts.appendJollyPoints();
 
-    labels.inside.resize(arr_out_tris.size() / 3);
+    if(stats)
+    {
+        stats->endPhase(PipelineStats::TRIANGULATION, &arena);
+        stats->num_lpi = static_cast<uint>(arena.numLPI());
+        stats->num_tpi = static_cast<uint>(arena.numTPI());
+    }
+
+    return !stopRequested(cancel);
 }
 
 //:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
@@ -285,14 +712,21 @@ void customRemoveDegenerateAndDuplicatedTriangles(const std::vector<genericPoint
 
 //:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
-void customDetectIntersections(const TriangleSoup &ts, std::vector<std::pair<uint, uint> > &intersection_list, cinolib::Octree &o)
+void customDetectIntersections(const TriangleSoup &ts, std::vector<std::pair<uint, uint> > &intersection_list, cinolib::Octree &o,
+                               PipelineStats *stats, const CancellationToken *cancel)
 {
+    if(stats) stats->beginPhase();
     std::vector<cinolib::vec3d> verts(ts.numVerts());
 
     for(uint v_id = 0; v_id < ts.numVerts(); v_id++)
         verts[v_id] = cinolib::vec3d(ts.vertX(v_id), ts.vertY(v_id), ts.vertZ(v_id));
 
     o.build_from_vectors(verts, ts.trisVector());
+    if(stats)
+    {
+        stats->endPhase(PipelineStats::OCTREE);
+        stats->beginPhase();
+    }
 
     intersection_list.reserve(ts.numTris());
 
@@ -300,7 +734,7 @@ void customDetectIntersections(const TriangleSoup &ts, std::vector<std::pair<uin
     tbb::parallel_for((uint)0, (uint)o.leaves.size(), [&](uint i)
     {
         auto & leaf = o.leaves[i];
-        if(leaf->item_indices.empty()) return;
+        if(leaf->item_indices.empty() || stopRequested(cancel)) return;
         for(uint j=0;   j<leaf->item_indices.size()-1; ++j)
             for(uint k=j+1; k<leaf->item_indices.size();   ++k)
             {
@@ -321,6 +755,7 @@ void customDetectIntersections(const TriangleSoup &ts, std::vector<std::pair<uin
             }
     });
     remove_duplicates(intersection_list);
+    if(stats) stats->endPhase(PipelineStats::DETECTION);
 }
 
 
@@ -364,7 +799,7 @@ void addDuplicateTrisInfoInStructures(const std::vector<DuplTriInfo> &dupl_tris,
 
 //:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
-void computeAllPatches(FastTrimesh &tm, const Labels &labels, std::vector<phmap::flat_hash_set<uint>> &patches, bool parallel)
+void computeAllPatches(FastTrimesh &tm, Labels &labels, std::vector<phmap::flat_hash_set<uint>> &patches, bool parallel)
 {
     if(parallel) {
         tm.resetVerticesInfo();
@@ -390,6 +825,22 @@ void computeAllPatches(FastTrimesh &tm, const Labels &labels, std::vector<phmap:
             }
         }
     }
+
+    labels.patch.resize(tm.numTris());
+    labels.patch_surface.resize(patches.size());
+    labels.inside.assign(patches.size(), std::bitset<NBIT>());
+
+    auto set_patch = [&](uint p_id)
+    {
+        for(uint t_id : patches[p_id]) labels.patch[t_id] = p_id;
+        labels.patch_surface[p_id] = labels.surface[*patches[p_id].begin()]; // label of the first triangle of the patch
+    };
+
+    if(parallel) tbb::parallel_for((uint)0, (uint)patches.size(), set_patch);
+    else for(uint p_id = 0; p_id < patches.size(); p_id++) set_patch(p_id);
+
+    // from here on the surface label of a triangle is the one of its patch
+    std::vector<std::bitset<NBIT>>().swap(labels.surface);
 }
 
 //:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
@@ -540,9 +991,8 @@ void findRayEndpoints(const FastTrimesh &tm, const phmap::flat_hash_set<uint> &p
         }
     }
 
-    std::cout << "WARNING: the arrangement contains a fully implicit patch that requires exact rationals for evaluation. This version of the code does not support rationals, therefore the output result may contain open boundaries." << std::endl;
-
-    std::exit(EXIT_FAILURE);
+    throw std::runtime_error("the arrangement contains a fully implicit patch that requires exact rationals for evaluation. "
+                             "This version of the code does not support rationals");
 }
 
 //:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
@@ -591,13 +1041,19 @@ bool intersects_box(const cinolib::Octree& tree, const cinolib::AABB & b, phmap:
 
 void computeInsideOut(const FastTrimesh &tm, const std::vector<phmap::flat_hash_set<uint>> &patches, const cinolib::Octree &octree,
                              const std::vector<genericPoint *> &in_verts, const std::vector<uint> &in_tris,
-                             const std::vector<std::bitset<NBIT>> &in_labels, const cinolib::vec3d &max_coords, Labels &labels)
+                             const std::vector<std::bitset<NBIT>> &in_labels, const cinolib::vec3d &max_coords, Labels &labels,
+                             PipelineStats *stats, const CancellationToken *cancel)
 {
+    std::atomic<uint64_t> num_candidates(0);
+    std::atomic<uint> max_candidates(0);
+
     tbb::spin_mutex mutex;
     tbb::parallel_for((uint)0, (uint)patches.size(), [&](uint p_id)
     {
+        if(stopRequested(cancel)) return;
+
         const phmap::flat_hash_set<uint> &patch_tris = patches[p_id];
-        const std::bitset<NBIT> &patch_surface_label = labels.surface[*patch_tris.begin()]; // label of the first triangle of the patch
+        const std::bitset<NBIT> &patch_surface_label = labels.patch_surface[p_id];
 
         Ray ray;
         findRayEndpoints(tm, patch_tris, max_coords, ray);
@@ -609,6 +1065,14 @@ void computeInsideOut(const FastTrimesh &tm, const std::vector<phmap::flat_hash_
 
         intersects_box(octree, rayAABB, tmp_inters);
 
+        if(stats)
+        {
+            uint n = static_cast<uint>(tmp_inters.size());
+            num_candidates += n;
+            uint curr_max = max_candidates;
+            while(n > curr_max && !max_candidates.compare_exchange_weak(curr_max, n));
+        }
+
         std::vector<uint> sorted_inters;
         pruneIntersectionsAndSortAlongRay(ray, in_verts, in_tris, in_labels, tmp_inters, patch_surface_label,
                                           sorted_inters);
@@ -616,8 +1080,15 @@ void computeInsideOut(const FastTrimesh &tm, const std::vector<phmap::flat_hash_
         std::bitset<NBIT> patch_inner_label;
         analyzeSortedIntersections(ray, in_verts, in_tris, in_labels, sorted_inters, patch_inner_label);
 
-        propagateInnerLabelsOnPatch(patch_tris, patch_inner_label, labels);
+        labels.inside[p_id] = patch_inner_label;
     });
+
+    if(stats)
+    {
+        stats->num_rays = static_cast<uint>(patches.size());
+        stats->num_ray_candidates = num_candidates;
+        stats->max_ray_candidates = max_candidates;
+    }
 }
 
 
@@ -628,24 +1099,49 @@ void pruneIntersectionsAndSortAlongRay(const Ray &ray, const std::vector<generic
                                               const phmap::flat_hash_set<uint> &tmp_inters, const std::bitset<NBIT> &patch_surface_label,
                                               std::vector<uint> &inters_tris)
 {
+    // triangles with a label different from the patch, projected on the plane orthogonal to the ray.
+    // Their 2D orientations wrt the ray are computed all at once, so that the filter runs four at a time
+    std::vector<uint> cand_tris;
+    cand_tris.reserve(tmp_inters.size());
+    for(uint t_id : tmp_inters)
+        if(!patch_surface_label[bitsetToUint(in_labels[t_id])]) cand_tris.push_back(t_id);
+
+    double vq[2];
+    std::vector<double> proj_verts(6 * cand_tris.size());
+    for(uint i = 0; i < cand_tris.size(); i++)
+    {
+        uint t_id = cand_tris[i];
+        projectOnRayPlane(ray, in_verts[in_tris[3 * t_id]]->toExplicit3D(), in_verts[in_tris[3 * t_id +1]]->toExplicit3D(),
+                          in_verts[in_tris[3 * t_id +2]]->toExplicit3D(), &proj_verts[6 * i], &proj_verts[6 * i +2], &proj_verts[6 * i +4], vq);
+    }
+
+    std::vector<const double *> p1(3 * cand_tris.size()), p2(3 * cand_tris.size()), p3(3 * cand_tris.size(), vq);
+    for(uint i = 0; i < cand_tris.size(); i++)
+    {
+        for(uint j = 0; j < 3; j++)
+        {
+            p1[3 * i + j] = &proj_verts[6 * i + 2 * j];
+            p2[3 * i + j] = &proj_verts[6 * i + 2 * ((j + 1) % 3)];
+        }
+    }
+
+    std::vector<int> orient(3 * cand_tris.size());
+    orient2dBatch(p1.data(), p2.data(), p3.data(), orient.data(), orient.size());
+
     phmap::flat_hash_set<uint> visited_tri;
     visited_tri.reserve(tmp_inters.size()/6);
     std::pair<phmap::flat_hash_set<uint>::iterator, bool> ins;
 
-    for(uint t_id : tmp_inters)
+    for(uint i = 0; i < cand_tris.size(); i++)
     {
+        uint t_id = cand_tris[i];
         ins = visited_tri.insert(t_id);
         if(!ins.second) continue; // triangle already analyzed or in the one ring of a vert or in the adj of an edge
 
         const std::bitset<NBIT> tested_tri_label = in_labels[t_id];
-        uint uint_tri_label = bitsetToUint(tested_tri_label);
-        if(patch_surface_label[uint_tri_label]) continue; // <-- triangle of the same label of the tested patch
-
-        const explicitPoint3D &tv0 = in_verts[in_tris[3 * t_id]]->toExplicit3D();
-        const explicitPoint3D &tv1 = in_verts[in_tris[3 * t_id +1]]->toExplicit3D();
-        const explicitPoint3D &tv2 = in_verts[in_tris[3 * t_id +2]]->toExplicit3D();
 
-        IntersInfo ii = fast2DCheckIntersectionOnRay(ray, tv0, tv1, tv2);
+        IntersInfo ii = classifyIntersectionOnRay(&proj_verts[6 * i], &proj_verts[6 * i +2], &proj_verts[6 * i +4], vq,
+                                                  orient[3 * i], orient[3 * i +1], orient[3 * i +2]);
 
         if(ii == DISCARD || ii == NO_INT) continue;
 
@@ -1021,10 +1517,9 @@ int perturbRayAndFindIntersTri(const Ray &ray, const std::vector<genericPoint*>
 
 //:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
-IntersInfo fast2DCheckIntersectionOnRay(const Ray &ray, const explicitPoint3D &tv0, const explicitPoint3D &tv1, const explicitPoint3D &tv2)
+void projectOnRayPlane(const Ray &ray, const explicitPoint3D &tv0, const explicitPoint3D &tv1, const explicitPoint3D &tv2,
+                       double v0[], double v1[], double v2[], double vq[])
 {
-    double v0[2], v1[2], v2[2], vq[2];
-
     switch (ray.dir)
     {
         case 'X': // only YZ coordinates
@@ -1052,11 +1547,27 @@ IntersInfo fast2DCheckIntersectionOnRay(const Ray &ray, const explicitPoint3D &t
         } break;
 
     }
+}
+
+//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+IntersInfo fast2DCheckIntersectionOnRay(const Ray &ray, const explicitPoint3D &tv0, const explicitPoint3D &tv1, const explicitPoint3D &tv2)
+{
+    double v0[2], v1[2], v2[2], vq[2];
+    projectOnRayPlane(ray, tv0, tv1, tv2, v0, v1, v2, vq);
 
     double or01 = cinolib::orient2d(v0, v1, vq);
     double or12 = cinolib::orient2d(v1, v2, vq);
     double or20 = cinolib::orient2d(v2, v0, vq);
 
+    return classifyIntersectionOnRay(v0, v1, v2, vq, or01, or12, or20);
+}
+
+//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+IntersInfo classifyIntersectionOnRay(const double v0[], const double v1[], const double v2[], const double vq[],
+                                     double or01, double or12, double or20)
+{
     if((or01 >= 0 && or12 >= 0 && or20 >= 0) || (or01 <= 0 && or12 <= 0 && or20 <= 0))
     {
         // check if the the ray passes through a vert
@@ -1117,7 +1628,10 @@ bool checkIntersectionInsideTriangle3DImplPoints(const Ray &ray, const genericPo
 void sortIntersectedTrisAlongX(const Ray &ray, const std::vector<genericPoint*> &in_verts,
                                       const std::vector<uint> &in_tris, std::vector<uint> &inters_tris)
 {
-    phmap::btree_set< std::pair<genericPoint*, uint>, less_than_GP_on_X > inters_set; // <- <t_id, impl_point>
+    // the whole sort runs with upward rounding, the scope is suspended only for the uncertain comparisons
+    upwardRoundingScope scope;
+
+    phmap::btree_set< std::pair<genericPoint*, uint>, less_than_GP_on_X> inters_set(less_than_GP_on_X{&scope}); // <- <t_id, impl_point>
     std::vector<implicitPoint3D_LPI> arena;
     arena.reserve(inters_tris.size());
 
@@ -1145,20 +1659,26 @@ void sortIntersectedTrisAlongX(const Ray &ray, const std::vector<genericPoint*>
         const genericPoint *tv1 = in_verts[ray.tv[1]];
         const genericPoint *tv2 = in_verts[ray.tv[2]];
 
-        if(genericPoint::orient3D(*tv0, *tv1, *tv2, ray.v1) > 0)
+        auto orient = [&](const genericPoint &p)
         {
-            while(curr_int != inters_set.end() && genericPoint::orient3D(*tv0, *tv1, *tv2, *curr_int->first) < 0)
+            return scope.refine(genericPoint::orient3DFilter(*tv0, *tv1, *tv2, p), [&]() { return genericPoint::orient3D(*tv0, *tv1, *tv2, p); });
+        };
+
+        if(orient(ray.v1) > 0)
+        {
+            while(curr_int != inters_set.end() && orient(*curr_int->first) < 0)
                 curr_int++;
         }
         else
         {
-            while(curr_int != inters_set.end() && genericPoint::orient3D(*tv0, *tv1, *tv2, *curr_int->first) > 0)
+            while(curr_int != inters_set.end() && orient(*curr_int->first) > 0)
                 curr_int++;
         }
     }
     else // the ray is composed of 2 real explicit points
     {
-        while(curr_int != inters_set.end() && genericPoint::lessThanOnX(*curr_int->first, ray.v0) < 0)
+        while(curr_int != inters_set.end() && scope.refine(genericPoint::lessThanOnXFilter(*curr_int->first, ray.v0),
+                                                           [&]() { return genericPoint::lessThanOnX(*curr_int->first, ray.v0); }) < 0)
             curr_int++;
     }
 
@@ -1175,7 +1695,10 @@ void sortIntersectedTrisAlongX(const Ray &ray, const std::vector<genericPoint*>
 void sortIntersectedTrisAlongY(const Ray &ray, const std::vector<genericPoint*> &in_verts,
                                       const std::vector<uint> &in_tris, std::vector<uint> &inters_tris)
 {
-    phmap::btree_set< std::pair<genericPoint*, uint>, less_than_GP_on_Y > inters_set; // <- <t_id, impl_point>
+    // the whole sort runs with upward rounding, the scope is suspended only for the uncertain comparisons
+    upwardRoundingScope scope;
+
+    phmap::btree_set< std::pair<genericPoint*, uint>, less_than_GP_on_Y> inters_set(less_than_GP_on_Y{&scope}); // <- <t_id, impl_point>
     std::vector<implicitPoint3D_LPI> arena;
     arena.reserve(inters_tris.size());
 
@@ -1202,20 +1725,26 @@ void sortIntersectedTrisAlongY(const Ray &ray, const std::vector<genericPoint*>
         const genericPoint *tv1 = in_verts[ray.tv[1]];
         const genericPoint *tv2 = in_verts[ray.tv[2]];
 
-        if(genericPoint::orient3D(*tv0, *tv1, *tv2, ray.v1) > 0)
+        auto orient = [&](const genericPoint &p)
+        {
+            return scope.refine(genericPoint::orient3DFilter(*tv0, *tv1, *tv2, p), [&]() { return genericPoint::orient3D(*tv0, *tv1, *tv2, p); });
+        };
+
+        if(orient(ray.v1) > 0)
         {
-            while(curr_int != inters_set.end() && genericPoint::orient3D(*tv0, *tv1, *tv2, *curr_int->first) < 0)
+            while(curr_int != inters_set.end() && orient(*curr_int->first) < 0)
                 curr_int++;
         }
         else
         {
-            while(curr_int != inters_set.end() && genericPoint::orient3D(*tv0, *tv1, *tv2, *curr_int->first) > 0)
+            while(curr_int != inters_set.end() && orient(*curr_int->first) > 0)
                 curr_int++;
         }
     }
     else // the ray is composed of 2 real explicit points
     {
-        while(curr_int != inters_set.end() && genericPoint::lessThanOnY(*curr_int->first, ray.v0) < 0)
+        while(curr_int != inters_set.end() && scope.refine(genericPoint::lessThanOnYFilter(*curr_int->first, ray.v0),
+                                                           [&]() { return genericPoint::lessThanOnY(*curr_int->first, ray.v0); }) < 0)
             curr_int++;
     }
 
@@ -1232,7 +1761,10 @@ void sortIntersectedTrisAlongY(const Ray &ray, const std::vector<genericPoint*>
 void sortIntersectedTrisAlongZ(const Ray &ray, const std::vector<genericPoint*> &in_verts,
                                       const std::vector<uint> &in_tris, std::vector<uint> &inters_tris)
 {
-    phmap::btree_set< std::pair<genericPoint*, uint>, less_than_GP_on_Z> inters_set; // <- <t_id, impl_point>
+    // the whole sort runs with upward rounding, the scope is suspended only for the uncertain comparisons
+    upwardRoundingScope scope;
+
+    phmap::btree_set< std::pair<genericPoint*, uint>, less_than_GP_on_Z> inters_set(less_than_GP_on_Z{&scope}); // <- <t_id, impl_point>
     std::vector<implicitPoint3D_LPI> arena;
     arena.reserve(inters_tris.size());
 
@@ -1259,20 +1791,26 @@ void sortIntersectedTrisAlongZ(const Ray &ray, const std::vector<genericPoint*>
         const genericPoint *tv1 = in_verts[ray.tv[1]];
         const genericPoint *tv2 = in_verts[ray.tv[2]];
 
-        if(genericPoint::orient3D(*tv0, *tv1, *tv2, ray.v1) > 0)
+        auto orient = [&](const genericPoint &p)
+        {
+            return scope.refine(genericPoint::orient3DFilter(*tv0, *tv1, *tv2, p), [&]() { return genericPoint::orient3D(*tv0, *tv1, *tv2, p); });
+        };
+
+        if(orient(ray.v1) > 0)
         {
-            while(curr_int != inters_set.end() && genericPoint::orient3D(*tv0, *tv1, *tv2, *curr_int->first) < 0)
+            while(curr_int != inters_set.end() && orient(*curr_int->first) < 0)
                 curr_int++;
         }
         else
         {
-            while(curr_int != inters_set.end() && genericPoint::orient3D(*tv0, *tv1, *tv2, *curr_int->first) > 0)
+            while(curr_int != inters_set.end() && orient(*curr_int->first) > 0)
                 curr_int++;
         }
     }
     else // the ray is composed of 2 real explicit points
     {
-        while(curr_int != inters_set.end() && genericPoint::lessThanOnZ(*curr_int->first, ray.v0) < 0)
+        while(curr_int != inters_set.end() && scope.refine(genericPoint::lessThanOnZFilter(*curr_int->first, ray.v0),
+                                                           [&]() { return genericPoint::lessThanOnZ(*curr_int->first, ray.v0); }) < 0)
             curr_int++;
     }
 
@@ -1301,187 +1839,371 @@ uint checkTriangleOrientation(const Ray &ray, const explicitPoint3D &tv0, const
 
 //:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
-void propagateInnerLabelsOnPatch(const phmap::flat_hash_set<uint> &patch_tris, const std::bitset<NBIT> &patch_inner_label, Labels &labels)
+uint finalTriVertex(const FastTrimesh &tm, uint t_id, uint i)
 {
-    for(uint t_id : patch_tris)
-        labels.inside[t_id] = patch_inner_label;
+    return tm.tri(t_id)[(tm.triInfo(t_id) == 2) ? 2 - i : i]; // as flipTri, the first and last vertex are swapped
 }
 
 //:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
-void computeFinalExplicitResult(const FastTrimesh &tm, const Labels &labels, uint num_tris_in_final_res,
-                                       std::vector<double> &out_coords, std::vector<uint> &out_tris, 
-                                       std::vector<std::bitset<NBIT>> &out_label, bool flat_array)
+void numberFinalVertices(const FastTrimesh &tm, std::vector<uint> &kept_tris, std::vector<int> &vertex_index,
+                         std::vector<uint> &kept_verts, bool parallel)
 {
-    if(flat_array)
+    uint num_tris = static_cast<uint>(tm.numTris());
+    uint num_verts = static_cast<uint>(tm.numVerts());
+    vertex_index.assign(num_verts, -1);
+    kept_tris.clear();
+    kept_verts.clear();
+
+    if(!parallel)
     {
-        // loop over triangles and fix vertex indices
-        uint num_vertices = 0;
-        std::vector<int>  vertex_index(tm.numVerts(), -1);
-        out_tris.resize(3 * num_tris_in_final_res);
-        out_label.resize(num_tris_in_final_res);
-        uint tri_offset = 0;
-        for(uint t_id = 0; t_id < tm.numTris(); t_id++)
+        for(uint t_id = 0; t_id < num_tris; t_id++)
         {
             if(tm.triInfo(t_id) == 0) continue; // triangle not included in final version
-            const uint *triangle = tm.tri(t_id);
             for(uint i = 0; i < 3; i++)
             {
-                uint old_vertex = triangle[i];
-                if (vertex_index[old_vertex] == -1) {
-                    vertex_index[old_vertex] = num_vertices ++;
+                uint v_id = finalTriVertex(tm, t_id, i);
+                if(vertex_index[v_id] == -1)
+                {
+                    vertex_index[v_id] = static_cast<int>(kept_verts.size());
+                    kept_verts.push_back(v_id);
                 }
-                out_tris[3 * tri_offset + i] = vertex_index[old_vertex];
             }
-            out_label[tri_offset] = labels.surface[t_id];
-            tri_offset++;
+            kept_tris.push_back(t_id);
+        }
+        return;
+    }
+
+    // selected triangles, compacted with a prefix sum
+    kept_tris.resize(num_tris);
+    uint num_kept = tbb::parallel_scan(tbb::blocked_range<uint>(0, num_tris), 0u,
+                                       [&](const tbb::blocked_range<uint> &r, uint sum, bool is_final)
+    {
+        for(uint t_id = r.begin(); t_id < r.end(); t_id++)
+        {
+            if(tm.triInfo(t_id) == 0) continue;
+            if(is_final) kept_tris[sum] = t_id;
+            sum++;
         }
+        return sum;
+    }, std::plus<uint>());
+    kept_tris.resize(num_kept);
+
+    // first corner (3 * position of the triangle in kept_tris + offset) using each vertex
+    std::vector<std::atomic<uint>> first_corner(num_verts);
+    tbb::parallel_for((uint)0, num_verts, [&](uint v_id) { first_corner[v_id].store(UINT_MAX, std::memory_order_relaxed); });
 
-        // loop over vertices
-        out_coords.resize(3 * num_vertices);
-        for(uint v_id = 0; v_id < (uint)tm.numVerts(); v_id++) {
-            if (vertex_index[v_id] == -1) continue;
-            double* v = out_coords.data() + (3 * vertex_index[v_id]);
-            tm.vert(v_id)->getApproxXYZCoordinates(v[0], v[1], v[2]);
+    tbb::parallel_for((uint)0, num_kept, [&](uint k)
+    {
+        for(uint i = 0; i < 3; i++)
+        {
+            uint c = 3 * k + i;
+            uint v_id = finalTriVertex(tm, kept_tris[k], i);
+            uint curr = first_corner[v_id].load(std::memory_order_relaxed);
+            while(c < curr && !first_corner[v_id].compare_exchange_weak(curr, c, std::memory_order_relaxed));
         }
+    });
+
+    // new ids: prefix sum of the first corners, so that the vertices are numbered in order of first use
+    kept_verts.resize(num_verts);
+    uint num_used = tbb::parallel_scan(tbb::blocked_range<uint>(0, 3 * num_kept), 0u,
+                                       [&](const tbb::blocked_range<uint> &r, uint sum, bool is_final)
+    {
+        for(uint c = r.begin(); c < r.end(); c++)
+        {
+            uint v_id = finalTriVertex(tm, kept_tris[c / 3], c % 3);
+            if(first_corner[v_id].load(std::memory_order_relaxed) != c) continue;
+            if(is_final)
+            {
+                vertex_index[v_id] = static_cast<int>(sum);
+                kept_verts[sum] = v_id;
+            }
+            sum++;
+        }
+        return sum;
+    }, std::plus<uint>());
+    kept_verts.resize(num_used);
+}
+
+//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+void computeFinalExplicitResult(const FastTrimesh &tm, const Labels &labels, uint num_tris_in_final_res,
+                                       std::vector<double> &out_coords, std::vector<uint> &out_tris, 
+                                       std::vector<std::bitset<NBIT>> &out_label, bool flat_array, bool parallel)
+{
+    double multiplier = tm.vert(tm.numVerts() - 1)->toExplicit3D().X();
+    std::vector<uint> kept_verts; // vertex of tm of each output vertex
+
+    if(flat_array)
+    {
+        std::vector<uint> kept_tris;
+        std::vector<int> vertex_index;
+        numberFinalVertices(tm, kept_tris, vertex_index, kept_verts, parallel);
+
+        uint num_tris = static_cast<uint>(kept_tris.size());
+
+        out_tris.resize(3 * static_cast<size_t>(num_tris));
+        out_label.resize(num_tris);
+        auto remap = [&](uint k)
+        {
+            for(uint i = 0; i < 3; i++)
+                out_tris[3 * static_cast<size_t>(k) + i] = static_cast<uint>(vertex_index[finalTriVertex(tm, kept_tris[k], i)]);
+            out_label[k] = labels.patch_surface[labels.patch[kept_tris[k]]];
+        };
 
-        // rescale output
-        double multiplier = tm.vert(tm.numVerts() - 1)->toExplicit3D().X();
-        for(double &c : out_coords) c /= multiplier;
+        if(parallel) tbb::parallel_for((uint)0, num_tris, remap);
+        else for(uint k = 0; k < num_tris; k++) remap(k);
     } else
     {
-        out_coords.reserve(3 * 3 * num_tris_in_final_res);
         out_tris.resize(3 * num_tris_in_final_res);
         out_label.resize(num_tris_in_final_res);
+        kept_verts.reserve(3 * num_tris_in_final_res);
         phmap::flat_hash_map<uint, uint> v_map;
         uint tri_offset = 0;
 
-        double multiplier = tm.vert(tm.numVerts() - 1)->toExplicit3D().X();
-
         for(uint t_id = 0; t_id < tm.numTris(); t_id++)
         {
             if(tm.triInfo(t_id) == 0) continue; // triangle not included in final version
 
-            const uint *v_id = tm.tri(t_id);
-
             for(uint i = 0; i < 3; i++)
             {
-                uint fresh_v_id = (uint)(out_coords.size() / 3);
-                auto ins = v_map.insert({v_id[i], fresh_v_id});
-
-                if(ins.second) // vert added
-                {
-                    double x, y, z;
-                    tm.vert(v_id[i])->getApproxXYZCoordinates(x, y, z);
-                    out_coords.push_back(x);
-                    out_coords.push_back(y);
-                    out_coords.push_back(z);
-                }
+                uint v_id = finalTriVertex(tm, t_id, i);
+                uint fresh_v_id = static_cast<uint>(kept_verts.size());
+                auto ins = v_map.insert({v_id, fresh_v_id});
+                if(ins.second) kept_verts.push_back(v_id); // vert added
 
                 out_tris[3 * tri_offset + i] = ins.first->second;
             }
-            out_label[tri_offset] = labels.surface[t_id];
+            out_label[tri_offset] = labels.patch_surface[labels.patch[t_id]];
             tri_offset++;
         }
-
-        for(double &c : out_coords)
-            c /= multiplier;
     }
+
+    // approximated coordinates, rescaled by blocks
+    uint num_verts = static_cast<uint>(kept_verts.size());
+    out_coords.resize(3 * static_cast<size_t>(num_verts));
+    auto convert = [&](const tbb::blocked_range<uint> &r)
+    {
+        for(uint v = r.begin(); v < r.end(); v++)
+        {
+            double *c = out_coords.data() + 3 * static_cast<size_t>(v);
+            tm.vert(kept_verts[v])->getApproxXYZCoordinates(c[0], c[1], c[2]);
+        }
+
+        double *c = out_coords.data() + 3 * static_cast<size_t>(r.begin());
+        for(size_t i = 0; i < 3 * static_cast<size_t>(r.size()); i++) c[i] /= multiplier;
+    };
+
+    if(parallel) tbb::parallel_for(tbb::blocked_range<uint>(0, num_verts), convert);
+    else convert(tbb::blocked_range<uint>(0, num_verts));
 }
 
 //:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
-uint boolIntersection(FastTrimesh &tm, const Labels &labels)
+void streamFinalExplicitResult(const FastTrimesh &tm, const Labels &labels, MeshSink &sink,
+                               bool parallel, uint chunk_size)
 {
-    uint num_tris_in_final_solution = 0;
-    tm.resetTrianglesInfo();
+    // vertices numbered in order of first use, as in computeFinalExplicitResult
+    std::vector<int> vertex_index;
+    std::vector<uint> kept_verts, kept_tris;
+    numberFinalVertices(tm, kept_tris, vertex_index, kept_verts, parallel);
 
-    for(uint t_id = 0; t_id < tm.numTris(); t_id++)
+    uint num_verts = static_cast<uint>(kept_verts.size());
+    uint num_tris = static_cast<uint>(kept_tris.size());
+    chunk_size = std::max(chunk_size, 1u);
+    double multiplier = tm.vert(tm.numVerts() - 1)->toExplicit3D().X();
+
+    sink.begin(num_verts, num_tris);
+
+    std::vector<double> coords(3 * static_cast<size_t>(std::min(chunk_size, num_verts)));
+    for(uint first = 0; first < num_verts; first += chunk_size)
     {
-        if((labels.surface[t_id] ^ labels.inside[t_id]).count() == labels.num) // triangle to keep
+        uint n = std::min(chunk_size, num_verts - first);
+        auto convert = [&](uint i)
         {
-            tm.setTriInfo(t_id, 1);
-            num_tris_in_final_solution++;
-        }
+            double *v = coords.data() + 3 * static_cast<size_t>(i);
+            tm.vert(kept_verts[first + i])->getApproxXYZCoordinates(v[0], v[1], v[2]);
+            v[0] /= multiplier;
+            v[1] /= multiplier;
+            v[2] /= multiplier;
+        };
+
+        if(parallel) tbb::parallel_for((uint)0, n, convert);
+        else for(uint i = 0; i < n; i++) convert(i);
+
+        sink.vertices(coords.data(), n);
+    }
+    std::vector<double>().swap(coords);
+
+    std::vector<uint> tris(3 * static_cast<size_t>(std::min(chunk_size, num_tris)));
+    std::vector<std::bitset<NBIT>> tri_labels(std::min(chunk_size, num_tris));
+    for(uint first = 0; first < num_tris; first += chunk_size)
+    {
+        uint n = std::min(chunk_size, num_tris - first);
+        auto remap = [&](uint i)
+        {
+            uint t_id = kept_tris[first + i];
+            for(uint j = 0; j < 3; j++) tris[3 * static_cast<size_t>(i) + j] = static_cast<uint>(vertex_index[finalTriVertex(tm, t_id, j)]);
+            tri_labels[i] = labels.patch_surface[labels.patch[t_id]];
+        };
+
+        if(parallel) tbb::parallel_for((uint)0, n, remap);
+        else for(uint i = 0; i < n; i++) remap(i);
+
+        sink.triangles(tris.data(), tri_labels.data(), n);
     }
 
-    return num_tris_in_final_solution;
+    sink.end();
 }
 
 //:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
-uint boolUnion(FastTrimesh &tm, const Labels &labels)
+void computeFinalImplicitResult(const FastTrimesh &tm, const Labels &labels, uint num_tris_in_final_res,
+                                std::vector<genericPoint*> &out_verts, std::vector<uint> &out_tris, std::vector<std::bitset<NBIT>> &out_label)
 {
-    uint num_tris_in_final_solution = 0;
-    tm.resetTrianglesInfo();
+    // vertices numbered in order of first use, as in computeFinalExplicitResult
+    std::vector<int> vertex_index(tm.numVerts(), -1);
+    out_verts.clear();
+    out_tris.resize(3 * num_tris_in_final_res);
+    out_label.resize(num_tris_in_final_res);
+    uint tri_offset = 0;
 
     for(uint t_id = 0; t_id < tm.numTris(); t_id++)
     {
-        if(labels.inside[t_id].count() == 0) // triangle to keep
+        if(tm.triInfo(t_id) == 0) continue; // triangle not included in final version
+        for(uint i = 0; i < 3; i++)
         {
-            tm.setTriInfo(t_id, 1);
-            num_tris_in_final_solution++;
+            uint old_vertex = finalTriVertex(tm, t_id, i);
+            if(vertex_index[old_vertex] == -1)
+            {
+                vertex_index[old_vertex] = static_cast<int>(out_verts.size());
+                out_verts.push_back(const_cast<genericPoint*>(tm.vert(old_vertex)));
+            }
+            out_tris[3 * tri_offset + i] = vertex_index[old_vertex];
         }
+        out_label[tri_offset] = labels.patch_surface[labels.patch[t_id]];
+        tri_offset++;
     }
 
-    return num_tris_in_final_solution;
+    // the multiplier, needed to scale the result back
+    out_verts.push_back(const_cast<genericPoint*>(tm.vert(tm.numVerts() - 1)));
 }
 
 //:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
-// if more than 2 models -> model 0 - all the others
-uint boolSubtraction(FastTrimesh &tm, const Labels &labels)
-{
-    uint num_tris_in_final_solution = 0;
-    tm.resetTrianglesInfo();
 
-    for(uint t_id = 0; t_id < tm.numTris(); t_id++)
+TriSelection BoolSelection::operator()(LabelMask surface, LabelMask inside, uint num_meshes) const
+{
+    switch(builtin)
     {
-        if(labels.surface[t_id][0] && labels.inside[t_id].count() == 0) // triangle to keep
-        {
-            tm.setTriInfo(t_id, 1);
-            num_tris_in_final_solution++;
-        }
-        else if(!labels.surface[t_id][0] && labels.inside[t_id][0] && labels.inside[t_id].count() == 1)
-        {
-            tm.setTriInfo(t_id, 1);
-            num_tris_in_final_solution++;
-        }
+        case UNION:        return unionRule(surface, inside, num_meshes);
+        case INTERSECTION: return intersectionRule(surface, inside, num_meshes);
+        case SUBTRACTION:  return subtractionRule(surface, inside, num_meshes);
+        case XOR:          return xorRule(surface, inside, num_meshes);
+        default:           return custom(surface, inside, num_meshes);
     }
+}
 
-    //fix triangles orientation
-    for(uint t_id = 0; t_id < tm.numTris(); t_id++)
+//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+BoolSelection BoolSelection::fromRegions(std::function<bool(LabelMask regions, uint num_meshes)> in_result)
+{
+    return BoolSelection([in_result](LabelMask surface, LabelMask inside, uint num_meshes)
     {
-        if(tm.triInfo(t_id) == 1 && labels.surface[t_id][0] != 1)
-            tm.flipTri(t_id);
-    }
+        // behind the triangle the point is also inside the meshes it lies on, in front of it it is not
+        bool behind   = in_result(inside | surface, num_meshes);
+        bool in_front = in_result(inside & ~surface, num_meshes);
 
-    return num_tris_in_final_solution;
+        if(behind == in_front) return DROP_TRI;
+        return (behind) ? KEEP_TRI : FLIP_TRI;
+    });
 }
 
 //:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
-uint boolXOR(FastTrimesh &tm, const Labels &labels)
+BoolSelection BoolSelection::fromTruthTable(std::vector<bool> table)
 {
-    uint num_tris_in_final_solution = 0;
-    tm.resetTrianglesInfo();
+    return fromRegions([table = std::move(table)](LabelMask regions, uint /*num_meshes*/)
+    {
+        return regions < table.size() && table[regions];
+    });
+}
 
-    for(uint t_id = 0; t_id < tm.numTris(); t_id++)
+//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+BoolSelection BoolSelection::atLeast(uint k)
+{
+    return fromRegions([k](LabelMask regions, uint /*num_meshes*/)
     {
-        if((labels.inside[t_id].count() == 0) || ((labels.surface[t_id] ^ labels.inside[t_id]).count() == labels.num)) // triangle to keep
+        return static_cast<uint>(std::popcount(regions)) >= k;
+    });
+}
+
+//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+uint applyPatchSelection(FastTrimesh &tm, const Labels &labels, const std::vector<TriSelection> &patch_sel, bool parallel)
+{
+    auto apply = [&](uint begin, uint end)
+    {
+        uint num_kept = 0;
+        for(uint t_id = begin; t_id < end; t_id++)
         {
-            tm.setTriInfo(t_id, 1);
-            num_tris_in_final_solution++;
+            TriSelection s = patch_sel[labels.patch[t_id]];
+            tm.setTriInfo(t_id, (s == DROP_TRI) ? 0 : (s == FLIP_TRI) ? 2 : 1);
+            num_kept += (s != DROP_TRI) ? 1 : 0;
         }
-    }
+        return num_kept;
+    };
 
-    // fix triangles orientation
-    for(uint t_id = 0; t_id < tm.numTris(); t_id++)
+    if(!parallel) return apply(0, tm.numTris());
+
+    return tbb::parallel_reduce(tbb::blocked_range<uint>(0, tm.numTris()), 0u,
+                                [&](const tbb::blocked_range<uint> &r, uint sum) { return sum + apply(r.begin(), r.end()); },
+                                std::plus<uint>());
+}
+
+//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+uint selectTriangles(FastTrimesh &tm, const Labels &labels, const BoolSelection &op, bool parallel)
+{
+    switch(op.op())
     {
-        if(tm.triInfo(t_id) == 1 && labels.inside[t_id].count() > 0)
-            tm.flipTri(t_id);
+        case UNION:        return selectTriangles(tm, labels, unionRule, parallel);
+        case INTERSECTION: return selectTriangles(tm, labels, intersectionRule, parallel);
+        case SUBTRACTION:  return selectTriangles(tm, labels, subtractionRule, parallel);
+        case XOR:          return selectTriangles(tm, labels, xorRule, parallel);
+        default:           break;
     }
 
-    return num_tris_in_final_solution;
+    if(!op.rule()) throw std::invalid_argument("selectTriangles() : empty BoolSelection rule");
+    return selectTriangles(tm, labels, op.rule(), parallel);
+}
+
+//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+uint boolIntersection(FastTrimesh &tm, const Labels &labels, bool parallel)
+{
+    return selectTriangles(tm, labels, intersectionRule, parallel);
+}
+
+//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+uint boolUnion(FastTrimesh &tm, const Labels &labels, bool parallel)
+{
+    return selectTriangles(tm, labels, unionRule, parallel);
+}
+
+//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+uint boolSubtraction(FastTrimesh &tm, const Labels &labels, bool parallel)
+{
+    return selectTriangles(tm, labels, subtractionRule, parallel);
+}
+
+//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+uint boolXOR(FastTrimesh &tm, const Labels &labels, bool parallel)
+{
+    return selectTriangles(tm, labels, xorRule, parallel);
 }
 
 //:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
@@ -43,13 +43,23 @@
 #include "triangle_soup.h"
 #include "intersection_classification.h"
 #include "triangulation.h"
+#include "parallel_config.h"
 #include <cinolib/octree.h>
 #include "io_functions.h"
+#include "mesh_sink.h"
 #include <bitset>
+#include <bit>
+#include <chrono>
+#include <functional>
+#include <memory>
 
+// patch is given per triangle, patch_surface and inside per patch (see computeAllPatches): all the triangles
+// of a patch share the same labels. surface holds the label of each triangle only until the patches are built
 struct Labels
 {
     std::vector< std::bitset<NBIT> > surface;
+    std::vector<uint>                patch;
+    std::vector< std::bitset<NBIT> > patch_surface;
     std::vector< std::bitset<NBIT> > inside;
     uint num;
 };
@@ -71,59 +81,280 @@ struct DuplTriInfo
 
 enum BoolOp {UNION, INTERSECTION, SUBTRACTION, XOR, NONE};
 
+// fate of a triangle of the arrangement in the result of a boolean
+enum TriSelection {DROP_TRI, KEEP_TRI, FLIP_TRI}; // FLIP_TRI: kept, with opposite orientation
+
+// a label as a bit mask, bit i for mesh i
+typedef uint64_t LabelMask;
+static_assert(NBIT <= 64, "labels must fit in a LabelMask");
+
+inline LabelMask labelMask(const std::bitset<NBIT> &b) { return static_cast<LabelMask>(b.to_ullong()); }
+
+// rule of a boolean: the fate of a triangle lying on the surface of the meshes in surface, and inside the meshes
+// in inside. num_meshes is the number of input meshes (Labels::num)
+typedef std::function<TriSelection(LabelMask surface, LabelMask inside, uint num_meshes)> SelectionRule;
+
+// rules of the built-in operations
+inline TriSelection unionRule(LabelMask /*surface*/, LabelMask inside, uint /*num_meshes*/)
+{
+    return (inside == 0) ? KEEP_TRI : DROP_TRI;
+}
+
+inline TriSelection intersectionRule(LabelMask surface, LabelMask inside, uint num_meshes)
+{
+    return (static_cast<uint>(std::popcount(surface ^ inside)) == num_meshes) ? KEEP_TRI : DROP_TRI;
+}
+
+// if more than 2 models -> model 0 - all the others
+inline TriSelection subtractionRule(LabelMask surface, LabelMask inside, uint /*num_meshes*/)
+{
+    if((surface & 1) && inside == 0) return KEEP_TRI;
+    if(!(surface & 1) && inside == 1) return FLIP_TRI; // inside model 0 only
+    return DROP_TRI;
+}
+
+inline TriSelection xorRule(LabelMask surface, LabelMask inside, uint num_meshes)
+{
+    if(inside == 0) return KEEP_TRI;
+    if(static_cast<uint>(std::popcount(surface ^ inside)) == num_meshes) return FLIP_TRI;
+    return DROP_TRI;
+}
+
+// The operation applied by a boolean pipeline: either one of the built-in BoolOp (implicit conversion, so that
+// a BoolOp can be passed wherever a BoolSelection is expected) or any SelectionRule, evaluated by selectTriangles
+class BoolSelection
+{
+    public:
+
+        BoolSelection(BoolOp op = UNION) : builtin(op) {}
+        explicit BoolSelection(SelectionRule rule) : builtin(NONE), custom(std::move(rule)) {}
+
+        // CSG form: in_result(regions, num_meshes) tells if the points inside exactly the meshes in regions
+        // belong to the result. A triangle is kept where in_result changes across it, oriented so that the
+        // result is behind it.
+        // Restriction: a patch shared by several meshes (coincident faces) keeps the winding of only one of
+        // them, so all the meshes in surface are taken as facing the same way. Where the shared faces are
+        // opposite (e.g. two solids touching face to face) the patch can be misclassified: e.g. the truth table
+        // of A - B drops the face where A touches B. Use a SelectionRule if the inputs have such contacts
+        static BoolSelection fromRegions(std::function<bool(LabelMask regions, uint num_meshes)> in_result);
+
+        // CSG form as a truth table: table[regions] for each of the 2^num_meshes region masks
+        static BoolSelection fromTruthTable(std::vector<bool> table);
+
+        // points inside at least k meshes (k = 1 is a union, k = num_meshes an intersection)
+        static BoolSelection atLeast(uint k);
+
+        BoolOp op() const { return builtin; } // NONE for a SelectionRule
+        const SelectionRule &rule() const { return custom; }
+
+        TriSelection operator()(LabelMask surface, LabelMask inside, uint num_meshes) const;
+
+    private:
+
+        BoolOp        builtin;
+        SelectionRule custom;
+};
+
+// report of a run of booleanPipeline: wall time and memory footprint of each phase, plus the
+// sizes that drive the cost of the phases (intersecting pairs, implicit points, patches, rays)
+struct PipelineStats
+{
+    enum Phase {MERGE, DEDUP, SOUP_INIT, OCTREE, DETECTION, CLASSIFICATION, TRIANGULATION,
+                PATCHES, INSIDE_OUT, SELECTION, OUTPUT, NUM_PHASES};
+
+    double time[NUM_PHASES] = {};             // wall time, in seconds
+    size_t arena_peak_bytes[NUM_PHASES] = {}; // most memory held by the point arena during the phase (arrangement phases only)
+
+    // the peak resident set size is a process-wide high-water mark since the program started: it includes
+    // what was allocated before this run and by the runs executing concurrently with it
+    size_t process_peak_rss_bytes[NUM_PHASES] = {}; // process peak resident set size at the end of the phase
+    size_t peak_rss_growth_bytes[NUM_PHASES] = {};  // how much the process peak rose during the phase, 0 if it stayed below an earlier peak
+
+    uint num_intersection_pairs = 0;
+    uint num_lpi = 0;
+    uint num_tpi = 0;
+    uint num_patches = 0;
+    uint num_rays = 0;                        // one per patch, perturbed rays excluded
+    uint64_t num_ray_candidates = 0;          // triangles whose bbox is hit by a ray, summed over all the rays
+    uint max_ray_candidates = 0;
+    uint num_rounded_verts = 0;               // chainedBooleanPipeline only: implicit input vertices not representable in doubles
+
+    PredicateStats predicates;                // filled only if COUNT_PREDICATE_STAGES is defined, includes the counts of concurrent runs
+
+    PipelineStatus status = PIPELINE_COMPLETED; // if not completed, the output is empty and the phases after the stop are zero
+
+    static const char *phaseName(int p);
+
+    void beginPhase();
+    void endPhase(Phase p, point_arena *arena = nullptr); // restarts the peak of the arena for the next phase
+
+    std::chrono::steady_clock::time_point phase_start;
+    size_t phase_start_rss = 0;
+};
+
+size_t peakResidentSetSize();
+
+// result of a boolean in implicit form, that can be chained into another boolean (chainedBooleanPipeline)
+// without rounding it to doubles first. As arr_verts, verts ends with the point (multiplier, 0, 0), and
+// refers to points owned by arena. verts may also come from readIMPL or readBinaryIMPL
+struct ImplicitResult
+{
+    std::unique_ptr<point_arena> arena = std::make_unique<point_arena>();
+    std::vector<genericPoint*> verts;
+    std::vector<uint> tris;
+    std::vector<std::bitset<NBIT>> labels;
+};
+
 enum IntersInfo {DISCARD, NO_INT, INT_IN_V0, INT_IN_V1, INT_IN_V2, INT_IN_EDGE01, INT_IN_EDGE12, INT_IN_EDGE20, INT_IN_TRI};
 
 struct less_than_GP_on_X // lessThan GenericPoint along X
 {
+    upwardRoundingScope *scope = nullptr; // if set, comparisons are evaluated within it
+
     bool operator() (const std::pair<genericPoint*, uint> &p0, const std::pair<genericPoint*, uint> &p1) const
     {
+        if(scope) return (scope->refine(genericPoint::lessThanOnXFilter(*p0.first, *p1.first),
+                                        [&]() { return genericPoint::lessThanOnX(*p0.first, *p1.first); }) <= 0);
+
         return (genericPoint::lessThanOnX(*p0.first, *p1.first) <= 0);
     }
 };
 
 struct less_than_GP_on_Y // lessThan GenericPoint along Y
 {
+    upwardRoundingScope *scope = nullptr; // if set, comparisons are evaluated within it
+
     bool operator() (const std::pair<genericPoint*, uint> &p0, const std::pair<genericPoint*, uint> &p1) const
     {
+        if(scope) return (scope->refine(genericPoint::lessThanOnYFilter(*p0.first, *p1.first),
+                                        [&]() { return genericPoint::lessThanOnY(*p0.first, *p1.first); }) <= 0);
+
         return (genericPoint::lessThanOnY(*p0.first, *p1.first) <= 0);
     }
 };
 
 struct less_than_GP_on_Z // lessThan GenericPoint along Z
 {
+    upwardRoundingScope *scope = nullptr; // if set, comparisons are evaluated within it
+
     bool operator() (const std::pair<genericPoint*, uint> &p0, const std::pair<genericPoint*, uint> &p1) const
     {
+        if(scope) return (scope->refine(genericPoint::lessThanOnZFilter(*p0.first, *p1.first),
+                                        [&]() { return genericPoint::lessThanOnZ(*p0.first, *p1.first); }) <= 0);
+
         return (genericPoint::lessThanOnZ(*p0.first, *p1.first) <= 0);
     }
 };
 
-void customBooleanPipeline(std::vector<genericPoint*>& arr_verts, std::vector<uint>& arr_in_tris,
+// customBooleanPipeline and customArrangementPipeline return false if they were stopped by cancel
+bool customBooleanPipeline(std::vector<genericPoint*>& arr_verts, std::vector<uint>& arr_in_tris,
                                   std::vector<uint>& arr_out_tris, std::vector<std::bitset<NBIT>>& arr_in_labels,
                                   std::vector<DuplTriInfo>& dupl_triangles, Labels& labels,
                                   std::vector<phmap::flat_hash_set<uint>>& patches, cinolib::Octree& octree,
-                                  const BoolOp &op, std::vector<double> &bool_coords, std::vector<uint> &bool_tris,
-                                  std::vector< std::bitset<NBIT>> &bool_labels);
-
-void booleanPipeline(const std::vector<double> &in_coords, const std::vector<uint> &in_tris,
-                            const std::vector<uint> &in_labels, const BoolOp &op, std::vector<double> &bool_coords,
-                            std::vector<uint> &bool_tris, std::vector< std::bitset<NBIT> > &bool_labels);
-
+                                  const BoolSelection &op, std::vector<double> &bool_coords, std::vector<uint> &bool_tris,
+                                  std::vector< std::bitset<NBIT>> &bool_labels, PipelineStats *stats = nullptr,
+                                  bool parallel = true, const CancellationToken *cancel = nullptr);
+
+// steps of customBooleanPipeline up to the selection of the triangles of the result, marked in tm
+// (built on arr_verts and arr_out_tris). Returns false if it was stopped by cancel
+bool customBooleanSelection(std::vector<genericPoint*>& arr_verts, std::vector<uint>& arr_in_tris,
+                            std::vector<std::bitset<NBIT>>& arr_in_labels,
+                            std::vector<DuplTriInfo>& dupl_triangles, Labels& labels,
+                            std::vector<phmap::flat_hash_set<uint>>& patches, cinolib::Octree& octree,
+                            const BoolSelection &op, FastTrimesh &tm, uint &num_tris_in_final_solution, PipelineStats *stats = nullptr,
+                            bool parallel = true, const CancellationToken *cancel = nullptr);
+
+// steps of customBooleanSelection that do not depend on the operation: patches of tm and their inside labels.
+// Returns false if it was stopped by cancel
+bool customPatchLabelling(std::vector<genericPoint*>& arr_verts, std::vector<uint>& arr_in_tris,
+                          std::vector<std::bitset<NBIT>>& arr_in_labels,
+                          std::vector<DuplTriInfo>& dupl_triangles, Labels& labels,
+                          std::vector<phmap::flat_hash_set<uint>>& patches, cinolib::Octree& octree,
+                          FastTrimesh &tm, PipelineStats *stats = nullptr, bool parallel = true,
+                          const CancellationToken *cancel = nullptr);
+
+// the whole pipeline runs as set by parallel (see parallel_config.h), and stops early if cancel
+// requests it (see cancellation.h): the outcome is reported in the status of the returned stats
+PipelineStats booleanPipeline(const std::vector<double> &in_coords, const std::vector<uint> &in_tris,
+                            const std::vector<uint> &in_labels, const BoolSelection &op, std::vector<double> &bool_coords,
+                            std::vector<uint> &bool_tris, std::vector< std::bitset<NBIT> > &bool_labels,
+                            TriangulationEngine engine = SPLIT_AND_WALK, const ParallelConfig &parallel = ParallelConfig(),
+                            const CancellationToken *cancel = nullptr);
+
+// same as above, with the result passed to sink (e.g. a file writer from makeFileSink) while it is produced
+// by streamFinalExplicitResult, instead of being stored. Nothing reaches sink if the pipeline is stopped
+PipelineStats booleanPipeline(const std::vector<double> &in_coords, const std::vector<uint> &in_tris,
+                            const std::vector<uint> &in_labels, const BoolSelection &op, MeshSink &sink,
+                            TriangulationEngine engine = SPLIT_AND_WALK, const ParallelConfig &parallel = ParallelConfig(),
+                            const CancellationToken *cancel = nullptr);
+
+// arrangement of the input meshes with the labels of its patches (arrangementPipeline), from which any number of
+// booleans can be extracted (selectBoolean). tm refers to points owned by arena, and is empty if the run was stopped
+struct LabelledArrangement
+{
+    std::unique_ptr<point_arena> arena = std::make_unique<point_arena>();
+    FastTrimesh tm;
+    Labels labels;
+};
 
-void customArrangementPipeline(const std::vector<double> &in_coords, const std::vector<uint> &in_tris, const std::vector<uint> &in_labels,
+// the steps of booleanPipeline that do not depend on the operation, with the result replacing the content of arr
+PipelineStats arrangementPipeline(const std::vector<double> &in_coords, const std::vector<uint> &in_tris,
+                                  const std::vector<uint> &in_labels, LabelledArrangement &arr,
+                                  TriangulationEngine engine = SPLIT_AND_WALK, const ParallelConfig &parallel = ParallelConfig(),
+                                  const CancellationToken *cancel = nullptr);
+
+// op applied to an arrangement: only the selection rule is evaluated again (once per patch), then the result is
+// written as by booleanPipeline. Only the SELECTION and OUTPUT phases of the stats are set. The selection is
+// stored in the triangles of arr.tm, so two selections on the same arrangement must not run concurrently
+PipelineStats selectBoolean(LabelledArrangement &arr, const BoolSelection &op, std::vector<double> &bool_coords,
+                            std::vector<uint> &bool_tris, std::vector<std::bitset<NBIT>> &bool_labels,
+                            const ParallelConfig &parallel = ParallelConfig());
+
+PipelineStats selectBoolean(LabelledArrangement &arr, const BoolSelection &op, MeshSink &sink,
+                            const ParallelConfig &parallel = ParallelConfig());
+
+// chained booleans: prev is the implicit result of a previous boolean, combined with the new meshes in
+// in_coords/in_tris/in_labels. prev is mesh 0, and the labels of the new meshes are shifted by one
+// (if prev is empty, the new meshes are taken as they are, to start a chain).
+// The vertices of prev are passed as they are when they are explicit, or when their exact coordinates are
+// representable in doubles; only the others are rounded (see stats.num_rounded_verts). The result
+// replaces the content of result, that can also be prev itself
+PipelineStats chainedBooleanPipeline(const ImplicitResult &prev, const std::vector<double> &in_coords,
+                                     const std::vector<uint> &in_tris, const std::vector<uint> &in_labels,
+                                     const BoolSelection &op, ImplicitResult &result,
+                                     TriangulationEngine engine = SPLIT_AND_WALK, const ParallelConfig &parallel = ParallelConfig(),
+                                     const CancellationToken *cancel = nullptr);
+
+// appends the triangles of an implicit result (as mesh label) to coords/tris/labels, scaled back to the
+// input space. Returns the number of vertices that had to be rounded
+uint appendImplicitResult(const ImplicitResult &res, uint label, std::vector<double> &coords, std::vector<uint> &tris,
+                          std::vector<uint> &labels, bool parallel = true);
+
+// explicit version of an implicit result, as computeFinalExplicitResult would produce it
+void implicitResultToExplicit(const ImplicitResult &res, std::vector<double> &coords, std::vector<uint> &tris,
+                              std::vector<std::bitset<NBIT>> &labels, bool parallel = true);
+
+
+bool customArrangementPipeline(const std::vector<double> &in_coords, const std::vector<uint> &in_tris, const std::vector<uint> &in_labels,
                                       std::vector<uint> &arr_in_tris, std::vector< std::bitset<NBIT>> &arr_in_labels,
                                       point_arena& arena, std::vector<genericPoint *> &vertices, std::vector<uint> &arr_out_tris, Labels &labels,
-                                      cinolib::Octree &octree, std::vector<DuplTriInfo> &dupl_triangles);
+                                      cinolib::Octree &octree, std::vector<DuplTriInfo> &dupl_triangles,
+                                      TriangulationEngine engine = SPLIT_AND_WALK, PipelineStats *stats = nullptr,
+                                      bool parallel = true, const CancellationToken *cancel = nullptr,
+                                      TriangulationSchedule schedule = INPUT_ORDER);
 
 void customRemoveDegenerateAndDuplicatedTriangles(const std::vector<genericPoint*> &verts, std::vector<uint> &tris,
                                                          std::vector< std::bitset<NBIT> > &labels, std::vector<DuplTriInfo> &dupl_triangles,
                                                          bool parallel);
 
-void customDetectIntersections(const TriangleSoup &ts, std::vector<std::pair<uint, uint> > &intersection_list, cinolib::Octree &o);
+void customDetectIntersections(const TriangleSoup &ts, std::vector<std::pair<uint, uint> > &intersection_list, cinolib::Octree &o,
+                               PipelineStats *stats = nullptr, const CancellationToken *cancel = nullptr);
 
 void addDuplicateTrisInfoInStructures(const std::vector<DuplTriInfo> &dupl_tris, std::vector<uint> &in_tris,
                                              std::vector<std::bitset<NBIT>> &in_labels, cinolib::Octree &octree);
 
-void computeAllPatches(FastTrimesh &tm, const Labels &labels, std::vector<phmap::flat_hash_set<uint>> &patches, bool parallel);
+// also fills the patch of each triangle and the surface label of each patch in labels
+void computeAllPatches(FastTrimesh &tm, Labels &labels, std::vector<phmap::flat_hash_set<uint>> &patches, bool parallel);
 
 void computeSinglePatch(FastTrimesh &tm, uint seed_t, const Labels &labels, phmap::flat_hash_set<uint> &patch);
 void computeSinglePatch(FastTrimesh &tm, uint seed_t, const Labels &labels, phmap::flat_hash_set<uint> &patch, const std::vector<std::array<uint, 3>>& adjT2E);
@@ -134,7 +365,8 @@ bool intersects_box(const cinolib::Octree& tree, const cinolib::AABB & b, phmap:
 
 void computeInsideOut(const FastTrimesh &tm, const std::vector<phmap::flat_hash_set<uint>> &patches, const cinolib::Octree &octree,
                              const std::vector<genericPoint *> &in_verts, const std::vector<uint> &in_tris,
-                             const std::vector<std::bitset<NBIT>> &in_labels, const cinolib::vec3d &max_coords, Labels &labels);
+                             const std::vector<std::bitset<NBIT>> &in_labels, const cinolib::vec3d &max_coords, Labels &labels,
+                             PipelineStats *stats = nullptr, const CancellationToken *cancel = nullptr);
 
 void pruneIntersectionsAndSortAlongRay(const Ray &ray, const std::vector<genericPoint*> &in_verts,
                                               const std::vector<uint> &in_tris, const std::vector<std::bitset<NBIT>> &in_labels,
@@ -164,8 +396,15 @@ Ray perturbZRay(const Ray &ray, uint offset);
 int perturbRayAndFindIntersTri(const Ray &ray, const std::vector<genericPoint*> &in_verts, const std::vector<uint> &in_tris,
                                        const std::vector<uint> &tris_to_test);
 
+void projectOnRayPlane(const Ray &ray, const explicitPoint3D &tv0, const explicitPoint3D &tv1, const explicitPoint3D &tv2,
+                       double v0[], double v1[], double v2[], double vq[]);
+
 IntersInfo fast2DCheckIntersectionOnRay(const Ray &ray, const explicitPoint3D &tv0, const explicitPoint3D &tv1, const explicitPoint3D &tv2);
 
+// same as fast2DCheckIntersectionOnRay, with the projected points and their orientations already computed
+IntersInfo classifyIntersectionOnRay(const double v0[], const double v1[], const double v2[], const double vq[],
+                                     double or01, double or12, double or20);
+
 bool checkIntersectionInsideTriangle3D(const Ray &ray, const explicitPoint3D &tv0, const explicitPoint3D &tv1, const explicitPoint3D &tv2);
 
 bool checkIntersectionInsideTriangle3DImplPoints(const Ray &ray, const genericPoint *tv0, const genericPoint *tv1, const genericPoint *tv2);
@@ -181,18 +420,65 @@ void sortIntersectedTrisAlongZ(const Ray &ray, const std::vector<genericPoint*>
 
 uint checkTriangleOrientation(const Ray &ray, const explicitPoint3D &tv0, const explicitPoint3D &tv1, const explicitPoint3D &tv2);
 
-void propagateInnerLabelsOnPatch(const phmap::flat_hash_set<uint> &patch_tris, const std::bitset<NBIT> &patch_inner_label, Labels &labels);
-
+// output mesh of the triangles selected in tm, with approximated coordinates. The vertices are numbered in
+// order of first use, either with flat arrays (numberFinalVertices) or with a hash map (flat_array = false,
+// always serial). The coordinates are approximated in parallel in both cases, unless parallel is false
 void computeFinalExplicitResult(const FastTrimesh &tm, const Labels &labels, uint num_tris_in_final_res,
-                                       std::vector<double> &out_coords, std::vector<uint> &out_tris, std::vector<std::bitset<NBIT>> &out_label, bool flat_array);
+                                       std::vector<double> &out_coords, std::vector<uint> &out_tris, std::vector<std::bitset<NBIT>> &out_label,
+                                       bool flat_array = true, bool parallel = true);
+
+// numbering of the vertices of the triangles selected in tm, in order of first use: kept_tris are the selected
+// triangles, vertex_index the new id of each vertex of tm (-1 if not used) and kept_verts the vertex of each new id.
+// In parallel, the order of first use is found with two prefix sums (triangles, then corners)
+void numberFinalVertices(const FastTrimesh &tm, std::vector<uint> &kept_tris, std::vector<int> &vertex_index,
+                         std::vector<uint> &kept_verts, bool parallel = true);
+
+// vertex i of triangle t_id in the result, reversed if the selection flipped it (triInfo 2)
+uint finalTriVertex(const FastTrimesh &tm, uint t_id, uint i);
+
+// same output of computeFinalExplicitResult, passed to sink in chunks of (at most) chunk_size vertices or
+// triangles. Only the new vertex ids and the ids of the selected triangles are stored for the whole result
+void streamFinalExplicitResult(const FastTrimesh &tm, const Labels &labels, MeshSink &sink,
+                               bool parallel = true, uint chunk_size = 1 << 16);
+
+// same selection of computeFinalExplicitResult, without rounding: the vertices are the points of tm, plus the
+// point (multiplier, 0, 0) at the end
+void computeFinalImplicitResult(const FastTrimesh &tm, const Labels &labels, uint num_tris_in_final_res,
+                                std::vector<genericPoint*> &out_verts, std::vector<uint> &out_tris, std::vector<std::bitset<NBIT>> &out_label);
+
+// evaluates rule once for each patch of labels
+template<typename Rule>
+void selectPatches(const Labels &labels, const Rule &rule, std::vector<TriSelection> &patch_sel)
+{
+    patch_sel.resize(labels.inside.size());
+    for(uint p_id = 0; p_id < patch_sel.size(); p_id++)
+        patch_sel[p_id] = rule(labelMask(labels.patch_surface[p_id]), labelMask(labels.inside[p_id]), labels.num);
+}
+
+// marks with triInfo 1 the triangles of tm whose patch is kept in patch_sel, 2 those kept flipped and 0 the others.
+// tm itself is not changed (the flips are applied by the output functions), so it can be selected again.
+// Returns the number of kept triangles
+uint applyPatchSelection(FastTrimesh &tm, const Labels &labels, const std::vector<TriSelection> &patch_sel, bool parallel = true);
+
+// marks the triangles of tm kept by rule, as applyPatchSelection. Returns the number of kept triangles
+template<typename Rule>
+uint selectTriangles(FastTrimesh &tm, const Labels &labels, const Rule &rule, bool parallel = true)
+{
+    std::vector<TriSelection> patch_sel;
+    selectPatches(labels, rule, patch_sel);
+    return applyPatchSelection(tm, labels, patch_sel, parallel);
+}
+
+// the built-in operations are evaluated with their rule inlined
+uint selectTriangles(FastTrimesh &tm, const Labels &labels, const BoolSelection &op, bool parallel = true);
 
-uint boolIntersection(FastTrimesh &tm, const Labels &labels);
+uint boolIntersection(FastTrimesh &tm, const Labels &labels, bool parallel = true);
 
-uint boolUnion(FastTrimesh &tm, const Labels &labels);
+uint boolUnion(FastTrimesh &tm, const Labels &labels, bool parallel = true);
 
-uint boolSubtraction(FastTrimesh &tm, const Labels &labels);
+uint boolSubtraction(FastTrimesh &tm, const Labels &labels, bool parallel = true);
 
-uint boolXOR(FastTrimesh &tm, const Labels &labels);
+uint boolXOR(FastTrimesh &tm, const Labels &labels, bool parallel = true);
 
 uint bitsetToUint(const std::bitset<NBIT> &b);
 
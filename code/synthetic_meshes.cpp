@@ -0,0 +1,209 @@
+/*****************************************************************************************
+ *              MIT License                                                              *
+ *                                                                                       *
+ * Copyright (c) 2022 G. Cherchi, F. Pellacini, M. Attene and M. Livesu                  *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION     *
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        *
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                *
+ *                                                                                       *
+ * Authors:                                                                              *
+ *      Gianmarco Cherchi (g.cherchi@unica.it)                                           *
+ *      https://www.gianmarcocherchi.com                                                 *
+ *                                                                                       *
+ *      Fabio Pellacini (fabio.pellacini@uniroma1.it)                                    *
+ *      https://pellacini.di.uniroma1.it                                                 *
+ *                                                                                       *
+ *      Marco Attene (marco.attene@ge.imati.cnr.it)                                      *
+ *      https://www.cnr.it/en/people/marco.attene/                                       *
+ *                                                                                       *
+ *      Marco Livesu (marco.livesu@ge.imati.cnr.it)                                      *
+ *      http://pers.ge.imati.cnr.it/livesu/                                              *
+ *                                                                                       *
+ * ***************************************************************************************/
+
+#include "synthetic_meshes.h"
+
+#include <cmath>
+#include <map>
+
+void appendSyntheticMesh(const std::vector<double> &m_coords, const std::vector<uint> &m_tris,
+                         std::vector<double> &coords, std::vector<uint> &tris, std::vector<uint> &labels)
+{
+    uint off = static_cast<uint>(coords.size() / 3); // prev num verts
+    uint label = (labels.empty()) ? 0 : labels.back() + 1;
+
+    coords.insert(coords.end(), m_coords.begin(), m_coords.end());
+
+    for(uint i = 0; i < m_tris.size(); i++) tris.push_back(m_tris[i] + off);
+
+    for(uint i = 0; i < m_tris.size() / 3; i++) labels.push_back(label);
+}
+
+//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+void gridBox(const double min[3], const double max[3], const uint res[3], std::vector<double> &coords, std::vector<uint> &tris)
+{
+    // lattice point (i,j,k) -> vertex id, only the points on the boundary get a vertex
+    std::vector<int> vmap((res[0] +1) * (res[1] +1) * (res[2] +1), -1);
+
+    auto vertex = [&](const uint l[3]) -> uint
+    {
+        int &v_id = vmap[(l[0] * (res[1] +1) + l[1]) * (res[2] +1) + l[2]];
+        if(v_id < 0)
+        {
+            v_id = static_cast<int>(coords.size() / 3);
+            for(uint a = 0; a < 3; a++) coords.push_back(min[a] + (max[a] - min[a]) * l[a] / res[a]);
+        }
+        return static_cast<uint>(v_id);
+    };
+
+    for(uint a = 0; a < 3; a++)
+    {
+        uint u = (a +1) % 3, v = (a +2) % 3; // (u,v,a) is a right-handed frame
+
+        for(uint side = 0; side < 2; side++)
+        {
+            for(uint iu = 0; iu < res[u]; iu++)
+                for(uint iv = 0; iv < res[v]; iv++)
+                {
+                    uint l[3];
+                    l[a] = (side) ? res[a] : 0;
+
+                    l[u] = iu;    l[v] = iv;    uint v00 = vertex(l);
+                    l[u] = iu +1; l[v] = iv;    uint v10 = vertex(l);
+                    l[u] = iu +1; l[v] = iv +1; uint v11 = vertex(l);
+                    l[u] = iu;    l[v] = iv +1; uint v01 = vertex(l);
+
+                    if(side) tris.insert(tris.end(), {v00, v10, v11, v00, v11, v01}); // normal along +a
+                    else     tris.insert(tris.end(), {v00, v11, v10, v00, v01, v11}); // normal along -a
+                }
+        }
+    }
+}
+
+//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+void octaSphere(const double c[3], double r, uint subdiv, std::vector<double> &coords, std::vector<uint> &tris)
+{
+    std::vector<double> unit = {1,0,0, -1,0,0, 0,1,0, 0,-1,0, 0,0,1, 0,0,-1};
+    std::vector<uint> faces = {0,2,4, 2,1,4, 1,3,4, 3,0,4,
+                               2,0,5, 1,2,5, 3,1,5, 0,3,5};
+
+    for(uint s = 0; s < subdiv; s++)
+    {
+        std::map<std::pair<uint, uint>, uint> midpoints;
+
+        auto midpoint = [&](uint v0, uint v1) -> uint
+        {
+            std::pair<uint, uint> e = (v0 < v1) ? std::make_pair(v0, v1) : std::make_pair(v1, v0);
+            auto it = midpoints.find(e);
+            if(it != midpoints.end()) return it->second;
+
+            double m[3], len = 0.0;
+            for(uint a = 0; a < 3; a++)
+            {
+                m[a] = unit[3 * v0 + a] + unit[3 * v1 + a];
+                len += m[a] * m[a];
+            }
+            len = std::sqrt(len);
+
+            uint m_id = static_cast<uint>(unit.size() / 3);
+            for(uint a = 0; a < 3; a++) unit.push_back(m[a] / len);
+
+            midpoints[e] = m_id;
+            return m_id;
+        };
+
+        std::vector<uint> new_faces;
+        new_faces.reserve(4 * faces.size());
+
+        for(uint f = 0; f < faces.size(); f += 3)
+        {
+            uint v0 = faces[f], v1 = faces[f +1], v2 = faces[f +2];
+            uint m01 = midpoint(v0, v1), m12 = midpoint(v1, v2), m20 = midpoint(v2, v0);
+
+            new_faces.insert(new_faces.end(), {v0, m01, m20, m01, v1, m12, m20, m12, v2, m01, m12, m20});
+        }
+
+        faces.swap(new_faces);
+    }
+
+    uint off = static_cast<uint>(coords.size() / 3);
+
+    for(uint v = 0; v < unit.size(); v += 3)
+        for(uint a = 0; a < 3; a++) coords.push_back(c[a] + r * unit[v + a]);
+
+    for(uint f : faces) tris.push_back(f + off);
+}
+
+//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+void stackedCubes(uint num_cubes, uint res, double shift, std::vector<double> &coords, std::vector<uint> &tris, std::vector<uint> &labels)
+{
+    const uint cube_res[3] = {res, res, res};
+
+    for(uint i = 0; i < num_cubes; i++)
+    {
+        double s = (i % 2) ? shift : 0.0;
+        double min[3] = {s, s, static_cast<double>(i)};
+        double max[3] = {s + 1.0, s + 1.0, static_cast<double>(i +1)};
+
+        std::vector<double> m_coords;
+        std::vector<uint> m_tris;
+        gridBox(min, max, cube_res, m_coords, m_tris);
+
+        appendSyntheticMesh(m_coords, m_tris, coords, tris, labels);
+    }
+}
+
+//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+void coplanarLatticeSlabs(uint num_slabs, uint res, std::vector<double> &coords, std::vector<uint> &tris, std::vector<uint> &labels)
+{
+    const uint slab_res[3] = {res, res, 1};
+    const double half_cell = 0.5 / res;
+
+    for(uint i = 0; i < num_slabs; i++)
+    {
+        double s = i * half_cell;
+        double min[3] = {s, s, 0.25 * i};
+        double max[3] = {s + 1.0, s + 1.0, 0.25 * (i +1)};
+
+        std::vector<double> m_coords;
+        std::vector<uint> m_tris;
+        gridBox(min, max, slab_res, m_coords, m_tris);
+
+        appendSyntheticMesh(m_coords, m_tris, coords, tris, labels);
+    }
+}
+
+//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+void coincidentSpherePacking(uint n, uint subdiv, double spacing, std::vector<double> &coords, std::vector<uint> &tris, std::vector<uint> &labels)
+{
+    for(uint i = 0; i < n; i++)
+        for(uint j = 0; j < n; j++)
+        {
+            double c[3] = {spacing * i, spacing * j, 0.0};
+
+            std::vector<double> m_coords;
+            std::vector<uint> m_tris;
+            octaSphere(c, 1.0, subdiv, m_coords, m_tris);
+
+            appendSyntheticMesh(m_coords, m_tris, coords, tris, labels);
+        }
+}
@@ -0,0 +1,74 @@
+/*****************************************************************************************
+ *              MIT License                                                              *
+ *                                                                                       *
+ * Copyright (c) 2022 G. Cherchi, F. Pellacini, M. Attene and M. Livesu                  *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION     *
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        *
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                *
+ *                                                                                       *
+ * Authors:                                                                              *
+ *      Gianmarco Cherchi (g.cherchi@unica.it)                                           *
+ *      https://www.gianmarcocherchi.com                                                 *
+ *                                                                                       *
+ *      Fabio Pellacini (fabio.pellacini@uniroma1.it)                                    *
+ *      https://pellacini.di.uniroma1.it                                                 *
+ *                                                                                       *
+ *      Marco Attene (marco.attene@ge.imati.cnr.it)                                      *
+ *      https://www.cnr.it/en/people/marco.attene/                                       *
+ *                                                                                       *
+ *      Marco Livesu (marco.livesu@ge.imati.cnr.it)                                      *
+ *      http://pers.ge.imati.cnr.it/livesu/                                              *
+ *                                                                                       *
+ * ***************************************************************************************/
+
+#ifndef SYNTHETIC_MESHES_H
+#define SYNTHETIC_MESHES_H
+
+#include <vector>
+
+typedef unsigned int uint;
+
+// Generators of synthetic inputs full of degeneracies (coplanar faces, shared edges, vertices lying
+// exactly on other faces, coincident vertices), which the bundled models barely exercise.
+// All the generators append their meshes to coords/tris/labels in the same format of loadMultipleFiles:
+// each mesh gets the next free label. All the meshes are closed, manifold and outward oriented.
+
+// appends a single mesh, with the next free label
+void appendSyntheticMesh(const std::vector<double> &m_coords, const std::vector<uint> &m_tris,
+                         std::vector<double> &coords, std::vector<uint> &tris, std::vector<uint> &labels);
+
+// axis aligned box [min,max], each face tessellated as a regular grid with res[i] cells along axis i
+void gridBox(const double min[3], const double max[3], const uint res[3], std::vector<double> &coords, std::vector<uint> &tris);
+
+// sphere of radius r centered in c, obtained subdividing an octahedron subdiv times.
+// The six poles are exactly c +/- r along the axes
+void octaSphere(const double c[3], double r, uint subdiv, std::vector<double> &coords, std::vector<uint> &tris);
+
+// num_cubes unit cubes stacked along Z, each one sharing its bottom face with the top face of the previous one.
+// Odd cubes are shifted by shift along X and Y, faces are res x res grids
+void stackedCubes(uint num_cubes, uint res, double shift, std::vector<double> &coords, std::vector<uint> &tris, std::vector<uint> &labels);
+
+// num_slabs unit squares slabs of thickness 1/4 stacked along Z, each one sharing its bottom face with the top face of
+// the previous one. Top and bottom faces are res x res grids, and each slab is shifted by half a cell along X and Y
+// w.r.t. the previous one, so that the grids of the shared faces cross each other everywhere
+void coplanarLatticeSlabs(uint num_slabs, uint res, std::vector<double> &coords, std::vector<uint> &tris, std::vector<uint> &labels);
+
+// n x n unit spheres centered on a planar grid with the given spacing. With spacing 2 neighbouring
+// spheres touch each other in a single point, which is a vertex of both
+void coincidentSpherePacking(uint n, uint subdiv, double spacing, std::vector<double> &coords, std::vector<uint> &tris, std::vector<uint> &labels);
+
+#endif // SYNTHETIC_MESHES_H
@@ -0,0 +1,563 @@
+/*****************************************************************************************
+ *              MIT License                                                              *
+ *                                                                                       *
+ * Copyright (c) 2022 G. Cherchi, F. Pellacini, M. Attene and M. Livesu                  *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION     *
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        *
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                *
+ *                                                                                       *
+ * Authors:                                                                              *
+ *      Gianmarco Cherchi (g.cherchi@unica.it)                                           *
+ *      https://www.gianmarcocherchi.com                                                 *
+ *                                                                                       *
+ *      Fabio Pellacini (fabio.pellacini@uniroma1.it)                                    *
+ *      https://pellacini.di.uniroma1.it                                                 *
+ *                                                                                       *
+ *      Marco Attene (marco.attene@ge.imati.cnr.it)                                      *
+ *      https://www.cnr.it/en/people/marco.attene/                                       *
+ *                                                                                       *
+ *      Marco Livesu (marco.livesu@ge.imati.cnr.it)                                      *
+ *      http://pers.ge.imati.cnr.it/livesu/                                              *
+ *                                                                                       *
+ * ***************************************************************************************/
+
+#ifdef _MSC_VER // Workaround for known bugs and issues on MSVC
+#define _HAS_STD_BYTE 0  // https://developercommunity.visualstudio.com/t/error-c2872-byte-ambiguous-symbol/93889
+#define NOMINMAX // https://stackoverflow.com/questions/1825904/error-c2589-on-stdnumeric-limitsdoublemin
+#endif
+
+#include <algorithm>
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include <thread>
+#include "booleans.h"
+#include "synthetic_meshes.h"
+
+#ifndef MESH_BOOLEANS_DATA_DIR
+#define MESH_BOOLEANS_DATA_DIR "../data/"
+#endif
+
+// Benchmark suite over the bundled datasets. Runs a fixed matrix of boolean operations
+// (pairwise on the resolution ladders, stencil-style on fertility and the spheres, and on the
+// degenerate inputs of synthetic_meshes.h) at several thread counts, and writes one record per
+// run, with the per-phase times of booleanPipeline. Predicate stage counts are written as well
+// if the library is built with COUNT_PREDICATE_STAGES.
+//
+// Each run is bounded to its thread count with a ParallelConfig, "serial" in the thread list
+// runs the serial path (reported as 0 threads). The speedup w.r.t. the first entry of the
+// list is printed for each case and operation, so that the default list is a scaling test.
+//
+// The triangulation engines in the --engine list and the schedules in the --schedule list are run
+// one after the other, to compare them.
+//
+// usage: mesh_booleans_bench [--data DIR] [--threads serial,1,2,4] [--engine split,cdt] [--schedule cost,input]
+//                            [--repeats N] [--filter STR] [--json FILE] [--csv FILE] [--quick] [--list] [--help]
+
+//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+struct BenchCase
+{
+    std::string name;                  // ladder/level, e.g. "bunny_cow/50k"
+    std::string ladder;
+    std::string level;
+    std::vector<std::string> files;    // relative to the data directory
+    std::vector<BoolOp> ops;
+
+    // if set, the input is synthesized instead of being loaded from files
+    std::function<void(std::vector<double>&, std::vector<uint>&, std::vector<uint>&)> generate;
+};
+
+struct BenchRun
+{
+    const BenchCase *bcase;
+    BoolOp op;
+    TriangulationEngine engine;
+    TriangulationSchedule schedule;
+    int threads;                       // 0 for the serial path
+    int repeat;
+    uint in_tris;
+    uint out_verts;
+    uint out_tris;
+    double load_time;
+    double total_time;
+    PipelineStats stats;
+};
+
+//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+const char *opName(BoolOp op)
+{
+    switch(op)
+    {
+        case UNION:         return "union";
+        case INTERSECTION:  return "intersection";
+        case SUBTRACTION:   return "subtraction";
+        case XOR:           return "xor";
+        default:            return "none";
+    }
+}
+
+const char *engineName(TriangulationEngine engine)
+{
+    return (engine == CONSTRAINED_DELAUNAY) ? "cdt" : "split";
+}
+
+const char *scheduleName(TriangulationSchedule schedule)
+{
+    return (schedule == INPUT_ORDER) ? "input" : "cost";
+}
+
+//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+std::vector<BenchCase> benchMatrix(bool quick)
+{
+    const std::vector<BoolOp> all_ops = {UNION, INTERSECTION, SUBTRACTION, XOR};
+
+    std::vector<BenchCase> matrix;
+
+    // pairwise: the same pair of models at increasing resolution
+    std::vector<std::pair<std::string, std::string>> bunny_cow = {{"bunny25k.obj",  "cow25k.obj"},
+                                                                   {"bunny50k.obj",  "cow50k.obj"},
+                                                                   {"bunny100k.obj", "cow100K.obj"}};
+
+    std::vector<std::pair<std::string, std::string>> cactus_bunny = {{"cactus25k.obj",  "bunny25k.obj"},
+                                                                      {"cactus50k.obj",  "bunny50k.obj"},
+                                                                      {"cactus100k.obj", "bunny100k.obj"}};
+
+    const char *levels[] = {"25k", "50k", "100k"};
+    uint num_levels = (quick) ? 1 : 3;
+
+    for(uint l = 0; l < num_levels; l++)
+        matrix.push_back({std::string("bunny_cow/") + levels[l], "bunny_cow", levels[l], {bunny_cow[l].first, bunny_cow[l].second}, all_ops, nullptr});
+
+    for(uint l = 0; l < num_levels; l++)
+        matrix.push_back({std::string("cactus_bunny/") + levels[l], "cactus_bunny", levels[l], {cactus_bunny[l].first, cactus_bunny[l].second}, all_ops, nullptr});
+
+    // stencil: fertility minus (or united with) a growing number of spheres
+    std::vector<uint> num_spheres = (quick) ? std::vector<uint>{8} : std::vector<uint>{8, 16, 30};
+
+    for(uint n : num_spheres)
+    {
+        BenchCase c;
+        c.ladder = "fertility_spheres";
+        c.level  = std::to_string(n);
+        c.name   = c.ladder + "/" + c.level;
+        c.ops    = {SUBTRACTION, UNION};
+        c.files.emplace_back("fertility.obj");
+        for(uint i = 0; i < n; i++) c.files.push_back("spheres/" + std::to_string(i) + ".obj");
+        matrix.push_back(c);
+    }
+
+    // synthetic degeneracies: coplanar shared faces, vertices on faces, coincident vertices
+    std::vector<uint> num_cubes = (quick) ? std::vector<uint>{4} : std::vector<uint>{4, 8, 16};
+    for(uint n : num_cubes)
+    {
+        BenchCase c;
+        c.ladder   = "stacked_cubes";
+        c.level    = std::to_string(n);
+        c.name     = c.ladder + "/" + c.level;
+        c.ops      = all_ops;
+        c.generate = [n](std::vector<double> &coords, std::vector<uint> &tris, std::vector<uint> &labels)
+                     { stackedCubes(n, 4, 0.125, coords, tris, labels); };
+        matrix.push_back(c);
+    }
+
+    std::vector<uint> slab_res = (quick) ? std::vector<uint>{8} : std::vector<uint>{8, 16, 32};
+    for(uint res : slab_res)
+    {
+        BenchCase c;
+        c.ladder   = "lattice_slabs";
+        c.level    = std::to_string(res);
+        c.name     = c.ladder + "/" + c.level;
+        c.ops      = all_ops;
+        c.generate = [res](std::vector<double> &coords, std::vector<uint> &tris, std::vector<uint> &labels)
+                     { coplanarLatticeSlabs(4, res, coords, tris, labels); };
+        matrix.push_back(c);
+    }
+
+    std::vector<uint> packing_size = (quick) ? std::vector<uint>{2} : std::vector<uint>{2, 3, 5};
+    for(uint n : packing_size)
+    {
+        BenchCase c;
+        c.ladder   = "sphere_packing";
+        c.level    = std::to_string(n);
+        c.name     = c.ladder + "/" + c.level;
+        c.ops      = all_ops;
+        c.generate = [n](std::vector<double> &coords, std::vector<uint> &tris, std::vector<uint> &labels)
+                     { coincidentSpherePacking(n, 4, 2.0, coords, tris, labels); };
+        matrix.push_back(c);
+    }
+
+    return matrix;
+}
+
+//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+std::vector<int> defaultThreadCounts()
+{
+    int hw = std::max(1, (int)std::thread::hardware_concurrency());
+
+    std::vector<int> counts;
+    for(int t = 1; t < hw; t *= 2) counts.push_back(t);
+    counts.push_back(hw);
+    return counts;
+}
+
+std::vector<int> parseThreadCounts(const std::string &s)
+{
+    std::vector<int> counts;
+    std::stringstream ss(s);
+    std::string tok;
+
+    while(std::getline(ss, tok, ','))
+    {
+        if(tok == "serial")
+        {
+            counts.push_back(0);
+            continue;
+        }
+
+        int t = std::atoi(tok.c_str());
+        if(t <= 0)
+        {
+            std::cerr << "invalid thread count: " << tok << std::endl;
+            exit(1);
+        }
+        counts.push_back(t);
+    }
+    return counts;
+}
+
+std::vector<TriangulationEngine> parseEngines(const std::string &s)
+{
+    std::vector<TriangulationEngine> engines;
+    std::stringstream ss(s);
+    std::string tok;
+
+    while(std::getline(ss, tok, ','))
+    {
+        if(tok == "split")      engines.push_back(SPLIT_AND_WALK);
+        else if(tok == "cdt")   engines.push_back(CONSTRAINED_DELAUNAY);
+        else
+        {
+            std::cerr << "invalid engine: " << tok << std::endl;
+            exit(1);
+        }
+    }
+    return engines;
+}
+
+std::vector<TriangulationSchedule> parseSchedules(const std::string &s)
+{
+    std::vector<TriangulationSchedule> schedules;
+    std::stringstream ss(s);
+    std::string tok;
+
+    while(std::getline(ss, tok, ','))
+    {
+        if(tok == "cost")       schedules.push_back(COST_ORDER);
+        else if(tok == "input") schedules.push_back(INPUT_ORDER);
+        else
+        {
+            std::cerr << "invalid schedule: " << tok << std::endl;
+            exit(1);
+        }
+    }
+    return schedules;
+}
+
+// number of predicates, of any family, that needed exact arithmetic
+uint64_t reachedExactStage(const PredicateStats &ps)
+{
+    uint64_t n = 0;
+    for(int f = 0; f < PF_NUM_FAMILIES; f++) n += ps.reached[f][PS_EXACT];
+    return n;
+}
+
+// how much the process peak resident set size rose while the phases of the run were executing
+size_t peakRSSGrowth(const PipelineStats &s)
+{
+    size_t n = 0;
+    for(int p = 0; p < PipelineStats::NUM_PHASES; p++) n += s.peak_rss_growth_bytes[p];
+    return n;
+}
+
+// process-wide peak resident set size at the end of the last phase that was executed
+size_t processPeakRSS(const PipelineStats &s)
+{
+    size_t n = 0;
+    for(int p = 0; p < PipelineStats::NUM_PHASES; p++) n = std::max(n, s.process_peak_rss_bytes[p]);
+    return n;
+}
+
+size_t arenaPeak(const PipelineStats &s)
+{
+    size_t n = 0;
+    for(int p = 0; p < PipelineStats::NUM_PHASES; p++) n = std::max(n, s.arena_peak_bytes[p]);
+    return n;
+}
+
+//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+void writeCSV(const std::string &filename, const std::vector<BenchRun> &runs)
+{
+    std::ofstream f(filename);
+    if(!f.is_open())
+    {
+        std::cerr << "cannot open " << filename << std::endl;
+        exit(1);
+    }
+
+    f << "case,ladder,level,op,engine,schedule,threads,repeat,in_tris,out_verts,out_tris,load_time,total_time";
+    for(int p = 0; p < PipelineStats::NUM_PHASES; p++) f << ",time_" << PipelineStats::phaseName(p);
+    f << ",arena_peak_bytes,peak_rss_growth_bytes,process_peak_rss_bytes,num_intersection_pairs,num_lpi,num_tpi,num_patches,num_rays,num_ray_candidates";
+
+    bool predicates = (!runs.empty() && runs.front().stats.predicates.enabled);
+    if(predicates)
+        for(int pf = 0; pf < PF_NUM_FAMILIES; pf++)
+            for(int ps = 0; ps < PS_NUM_STAGES; ps++)
+                f << "," << PredicateStats::familyName(pf) << "_" << PredicateStats::stageName(ps);
+    f << "\n";
+
+    for(const BenchRun &r : runs)
+    {
+        const PipelineStats &s = r.stats;
+        f << r.bcase->name << "," << r.bcase->ladder << "," << r.bcase->level << "," << opName(r.op) << ","
+          << engineName(r.engine) << "," << scheduleName(r.schedule) << "," << r.threads << "," << r.repeat << "," << r.in_tris << "," << r.out_verts << "," << r.out_tris << ","
+          << r.load_time << "," << r.total_time;
+        for(int p = 0; p < PipelineStats::NUM_PHASES; p++) f << "," << s.time[p];
+        f << "," << arenaPeak(s) << "," << peakRSSGrowth(s) << "," << processPeakRSS(s) << "," << s.num_intersection_pairs << ","
+          << s.num_lpi << "," << s.num_tpi << "," << s.num_patches << "," << s.num_rays << "," << s.num_ray_candidates;
+        if(predicates)
+            for(int pf = 0; pf < PF_NUM_FAMILIES; pf++)
+                for(int ps = 0; ps < PS_NUM_STAGES; ps++) f << "," << s.predicates.reached[pf][ps];
+        f << "\n";
+    }
+}
+
+void writeJSON(const std::string &filename, const std::vector<BenchRun> &runs, const std::vector<int> &threads, int repeats)
+{
+    std::ofstream f(filename);
+    if(!f.is_open())
+    {
+        std::cerr << "cannot open " << filename << std::endl;
+        exit(1);
+    }
+
+    f << "{\n  \"hardware_concurrency\": " << std::thread::hardware_concurrency() << ",\n";
+    f << "  \"repeats\": " << repeats << ",\n  \"threads\": [";
+    for(uint i = 0; i < threads.size(); i++) f << ((i) ? ", " : "") << threads[i];
+    f << "],\n  \"runs\": [\n";
+
+    for(uint i = 0; i < runs.size(); i++)
+    {
+        const BenchRun &r = runs[i];
+        const PipelineStats &s = r.stats;
+
+        f << "    {\"case\": \"" << r.bcase->name << "\", \"ladder\": \"" << r.bcase->ladder << "\", \"level\": \"" << r.bcase->level
+          << "\", \"op\": \"" << opName(r.op) << "\", \"engine\": \"" << engineName(r.engine) << "\", \"schedule\": \"" << scheduleName(r.schedule)
+          << "\", \"threads\": " << r.threads << ", \"repeat\": " << r.repeat
+          << ", \"in_tris\": " << r.in_tris << ", \"out_verts\": " << r.out_verts << ", \"out_tris\": " << r.out_tris
+          << ", \"load_time\": " << r.load_time << ", \"total_time\": " << r.total_time << ",\n     \"phases\": {";
+        for(int p = 0; p < PipelineStats::NUM_PHASES; p++)
+            f << ((p) ? ", " : "") << "\"" << PipelineStats::phaseName(p) << "\": " << s.time[p];
+        f << "},\n     \"arena_peak_bytes\": " << arenaPeak(s) << ", \"peak_rss_growth_bytes\": " << peakRSSGrowth(s)
+          << ", \"process_peak_rss_bytes\": " << processPeakRSS(s)
+          << ", \"num_intersection_pairs\": " << s.num_intersection_pairs << ", \"num_lpi\": " << s.num_lpi
+          << ", \"num_tpi\": " << s.num_tpi << ", \"num_patches\": " << s.num_patches << ", \"num_rays\": " << s.num_rays
+          << ", \"num_ray_candidates\": " << s.num_ray_candidates;
+        if(s.predicates.enabled)
+        {
+            f << ",\n     \"predicates\": {";
+            for(int pf = 0; pf < PF_NUM_FAMILIES; pf++)
+            {
+                f << ((pf) ? ", " : "") << "\"" << PredicateStats::familyName(pf) << "\": {";
+                for(int ps = 0; ps < PS_NUM_STAGES; ps++)
+                    f << ((ps) ? ", " : "") << "\"" << PredicateStats::stageName(ps) << "\": " << s.predicates.reached[pf][ps];
+                f << "}";
+            }
+            f << "}";
+        }
+        f << "}" << ((i +1 < runs.size()) ? "," : "") << "\n";
+    }
+
+    f << "  ]\n}\n";
+}
+
+//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+void printUsage(std::ostream &os)
+{
+    os << "usage: mesh_booleans_bench [options]\n"
+          "\n"
+          "  --data DIR          directory of the bundled datasets (default: " << MESH_BOOLEANS_DATA_DIR << ")\n"
+          "  --threads LIST      comma separated thread counts, \"serial\" for the serial path\n"
+          "                      (default: powers of two up to the hardware concurrency)\n"
+          "  --engine LIST       triangulation engines to compare: split, cdt (default: split)\n"
+          "  --schedule LIST     triangulation schedules to compare: cost, input (default: input)\n"
+          "  --repeats N         runs of each configuration (default: 3)\n"
+          "  --filter STR        only the cases whose name contains STR\n"
+          "  --json FILE         JSON report (default: bench.json)\n"
+          "  --csv FILE          CSV report (default: bench.csv)\n"
+          "  --quick             smallest level of each case only\n"
+          "  --list              print the cases and their operations, then exit\n"
+          "  --help              print this message, then exit\n";
+}
+
+//:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+int main(int argc, char **argv)
+{
+    std::string data_dir = MESH_BOOLEANS_DATA_DIR;
+    std::string json_file = "bench.json";
+    std::string csv_file = "bench.csv";
+    std::string filter;
+    std::vector<int> threads = defaultThreadCounts();
+    std::vector<TriangulationEngine> engines = {SPLIT_AND_WALK};
+    std::vector<TriangulationSchedule> schedules = {INPUT_ORDER};
+    int repeats = 3;
+    bool quick = false;
+    bool list = false;
+
+    for(int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        bool has_value = (i +1 < argc);
+
+        if(arg == "--data" && has_value)            data_dir = argv[++i];
+        else if(arg == "--threads" && has_value)    threads = parseThreadCounts(argv[++i]);
+        else if(arg == "--engine" && has_value)     engines = parseEngines(argv[++i]);
+        else if(arg == "--schedule" && has_value)   schedules = parseSchedules(argv[++i]);
+        else if(arg == "--repeats" && has_value)    repeats = std::max(1, std::atoi(argv[++i]));
+        else if(arg == "--filter" && has_value)     filter = argv[++i];
+        else if(arg == "--json" && has_value)       json_file = argv[++i];
+        else if(arg == "--csv" && has_value)        csv_file = argv[++i];
+        else if(arg == "--quick")                   quick = true;
+        else if(arg == "--list")                    list = true;
+        else if(arg == "--help" || arg == "-h")
+        {
+            printUsage(std::cout);
+            return 0;
+        }
+        else
+        {
+            std::cerr << "unknown option or missing value: " << arg << "\n\n";
+            printUsage(std::cerr);
+            return -1;
+        }
+    }
+
+    if(!data_dir.empty() && data_dir.back() != '/') data_dir += '/';
+
+    std::vector<BenchCase> matrix = benchMatrix(quick);
+
+    std::vector<BenchRun> runs;
+
+    for(const BenchCase &c : matrix)
+    {
+        if(!filter.empty() && c.name.find(filter) == std::string::npos) continue;
+
+        if((int)c.files.size() > NBIT)
+        {
+            std::cerr << c.name << ": set NBIT to a higher number!" << std::endl;
+            continue;
+        }
+
+        if(list)
+        {
+            std::cout << c.name;
+            if(!c.generate) std::cout << " (" << c.files.size() << " meshes)";
+            std::cout << ":";
+            for(BoolOp op : c.ops) std::cout << " " << opName(op);
+            std::cout << std::endl;
+            continue;
+        }
+
+        std::vector<double> in_coords;
+        std::vector<uint> in_tris, in_labels;
+
+        auto load_start = std::chrono::steady_clock::now();
+        if(c.generate) c.generate(in_coords, in_tris, in_labels);
+        else
+        {
+            std::vector<std::string> files;
+            for(const std::string &f : c.files) files.push_back(data_dir + f);
+            loadMultipleFiles(files, in_coords, in_tris, in_labels);
+        }
+        double load_time = std::chrono::duration<double>(std::chrono::steady_clock::now() - load_start).count();
+
+        if(!in_labels.empty() && (int)in_labels.back() >= NBIT)
+        {
+            std::cerr << c.name << ": set NBIT to a higher number!" << std::endl;
+            continue;
+        }
+
+        for(BoolOp op : c.ops)
+        {
+            for(TriangulationEngine engine : engines)
+            {
+                for(TriangulationSchedule schedule : schedules)
+                {
+                    double base = 0.0;
+
+                    for(int t : threads)
+                    {
+                        ParallelConfig parallel = (t == 0) ? ParallelConfig::serialRun() : ParallelConfig::threads(t);
+                        parallel.schedule = schedule;
+
+                        double best = std::numeric_limits<double>::max();
+                        uint64_t exact = 0;
+
+                        for(int r = 0; r < repeats; r++)
+                        {
+                            std::vector<double> bool_coords;
+                            std::vector<uint> bool_tris;
+                            std::vector<std::bitset<NBIT>> bool_labels;
+
+                            auto start = std::chrono::steady_clock::now();
+                            PipelineStats stats = booleanPipeline(in_coords, in_tris, in_labels, op, bool_coords, bool_tris, bool_labels,
+                                                                  engine, parallel);
+                            double total = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+                            runs.push_back({&c, op, engine, schedule, t, r, (uint)in_tris.size() / 3, (uint)bool_coords.size() / 3,
+                                            (uint)bool_tris.size() / 3, load_time, total, stats});
+
+                            best = std::min(best, total);
+                            exact = reachedExactStage(stats.predicates);
+                        }
+
+                        if(base == 0.0) base = best;
+
+                        std::cout << c.name << " " << opName(op) << " engine: " << engineName(engine)
+                                  << " schedule: " << scheduleName(schedule) << " threads: " << ((t) ? std::to_string(t) : "serial")
+                                  << " best: " << best << " s speedup: " << base / best;
+                        if(runs.back().stats.predicates.enabled) std::cout << " exact predicates: " << exact;
+                        std::cout << std::endl;
+                    }
+                }
+            }
+        }
+    }
+
+    if(list) return 0;
+
+    if(!json_file.empty()) writeJSON(json_file, runs, threads, repeats);
+    if(!csv_file.empty())  writeCSV(csv_file, runs);
+
+    return 0;
+}
@@ -91,27 +91,53 @@ int main(int argc, char **argv)
     bool wireframe = false;
     std::mutex mutex;
     std::atomic<bool> pause = false;
+    std::atomic<bool> exit = false;
+
+    // op and exit are published under job_mutex, together with the cancellation of the run in progress.
+    // The boolean thread resets cancel under the same lock when it takes the next job, so that a request
+    // made after the job was taken always reaches the run, and one made before it is never lost
+    std::mutex job_mutex;
+    CancellationToken cancel; // stops the run in progress when its result becomes obsolete
     gui.callback_key_pressed = [&](int key, int mod) -> bool
     {
-        if(key==GLFW_KEY_I) op = INTERSECTION; else
-        if(key==GLFW_KEY_U) op = UNION;        else
-        if(key==GLFW_KEY_S) op = SUBTRACTION;  else
+        BoolOp new_op = op;
+        if(key==GLFW_KEY_I) new_op = INTERSECTION; else
+        if(key==GLFW_KEY_U) new_op = UNION;        else
+        if(key==GLFW_KEY_S) new_op = SUBTRACTION;  else
         if(key==GLFW_KEY_SPACE) pause = !pause; else
         if(key==GLFW_KEY_W) wireframe = !wireframe;
+        if(new_op != op)
+        {
+            std::lock_guard<std::mutex> lock(job_mutex);
+            op = new_op;
+            cancel.cancel();
+        }
         return false;
     };
 
     // boolean thread
     std::atomic<bool> done = false;
-    std::atomic<bool> exit = false;
     std::atomic<int> count = 0;
     std::thread boolean_thread([&]()
     {
-       while(!exit)
+       while(true)
        {
+           BoolOp job_op;
+           {
+               std::lock_guard<std::mutex> lock(job_mutex);
+               if(exit) return;
+               job_op = op;
+               cancel.reset();
+           }
+
            back_coords.clear();
            back_tris.clear();
-           booleanPipeline(in_coords, in_tris, in_labels, op, back_coords, back_tris, back_labels);
+           PipelineStats stats = booleanPipeline(in_coords, in_tris, in_labels, job_op, back_coords, back_tris, back_labels,
+                                                 SPLIT_AND_WALK, ParallelConfig(), &cancel);
+
+           if(exit) return;
+           if(stats.status != PIPELINE_COMPLETED) continue; // obsolete frame, start over with the current op
+
            {
                std::lock_guard<std::mutex> lock(mutex);
                back_coords.swap(bool_coords);
@@ -167,7 +193,11 @@ int main(int argc, char **argv)
         glfwPollEvents();
     }
 
-    exit = true;
+    {
+        std::lock_guard<std::mutex> lock(job_mutex);
+        exit = true;
+        cancel.cancel();
+    }
     fps_exit_signal.set_value();
     if(boolean_thread.joinable()) boolean_thread.join();
     fps_thread.join();